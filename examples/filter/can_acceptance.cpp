@@ -0,0 +1,21 @@
+#include <mtl/bus/socketcan.h>
+#include <mtl/filter/can_acceptance.h>
+
+static mtl::filter::can_acceptance<16> rx_filter;
+
+void setup_filters(mtl::bus::socketcan<> &bus)
+{
+    rx_filter.add(mtl::can::filter{0x100u, 0x700u});       // 0x100..0x1ff, both formats
+    rx_filter.add({0x18fef100u, 0x18fef1ffu, true});        // extended range
+    rx_filter.compile();
+
+    // Let the kernel drop the rest before it reaches user space.
+    std::array<mtl::can::filter, 64> kernel;
+    const size_t n = rx_filter.to_kernel(kernel);
+    bus.set_filters({kernel.data(), std::min(n, kernel.size())});
+}
+
+bool wanted(const mtl::can::frame &frame)
+{
+    return rx_filter.matches(frame);
+}
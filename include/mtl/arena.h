@@ -0,0 +1,87 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file arena.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Statically allocated bump allocator.
+///
+/// Allocating only moves an offset forward, individual allocations are
+/// never freed: `reset()` releases everything at once (e.g. per received
+/// packet or per control loop iteration). Destructors are not run.
+///
+/// Not thread safe.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_ARENA_H
+#define MTL_ARENA_H
+
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace mtl
+{
+template <size_t Size>
+class arena
+{
+    static_assert(Size > 0u, "arena<Size>: Size must be > 0");
+
+    public:
+    using size_type = size_t;
+
+    arena() = default;
+
+    arena(const arena &)            = delete;
+    arena &operator=(const arena &) = delete;
+
+    /// @param align Power of two.
+    /// @return Uninitialized storage, nullptr when the arena is exhausted.
+    auto allocate(const size_type bytes, const size_type align = alignof(std::max_align_t)) -> void *
+    {
+        const auto base  = reinterpret_cast<uintptr_t>(this->_buffer);
+        const auto start = ((base + this->_used + align - 1u) & ~(uintptr_t{align} - 1u)) - base;
+
+        if (start > Size || bytes > Size - start)
+        {
+            return nullptr;
+        }
+
+        this->_used = start + bytes;
+        return this->_buffer + start;
+    }
+
+    /// @brief Allocates and constructs a T.
+    /// @return nullptr when the arena is exhausted.
+    template <typename T, typename... Args>
+    auto create(Args &&...args) -> T *
+    {
+        void *p = this->allocate(sizeof(T), alignof(T));
+        return p != nullptr ? new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /// @brief Releases every allocation.
+    void reset() { this->_used = 0u; }
+
+    auto get_used() const -> size_type { return this->_used; }
+    auto get_free() const -> size_type { return Size - this->_used; }
+    static constexpr auto capacity() -> size_type { return Size; }
+
+    /// @brief Tests if `p` points into this arena's storage.
+    auto owns(const void *p) const -> bool
+    {
+        const auto *b = static_cast<const std::byte *>(p);
+        return b >= this->_buffer && b < this->_buffer + Size;
+    }
+
+    private:
+    alignas(std::max_align_t) std::byte _buffer[Size];
+    size_type _used = 0u;
+};
+}
+
+#endif
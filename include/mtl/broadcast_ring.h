@@ -0,0 +1,205 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file broadcast_ring.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Single writer, many readers ring buffer.
+///
+/// Every reader owns a `cursor` and sees every element written after it
+/// subscribed, without removing it for the others. The writer never waits
+/// for readers: a reader that falls more than SIZE elements behind loses the
+/// oldest ones and its cursor counts them as dropped.
+///
+/// Memory and copy cost on the write side do not depend on the amount of
+/// readers. Readers may run in other threads/ISRs than the writer, each
+/// cursor must only be used by one reader at a time.
+///
+/// Elements are stored as machine words accessed through relaxed atomics, as
+/// a reader may copy an element while the writer overwrites it (the copy is
+/// then detected as torn and discarded).
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_BROADCAST_RING_H
+#define MTL_BROADCAST_RING_H
+
+#include <bit>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+#include "cache_line.h"
+
+namespace mtl
+{
+template <typename T, size_t SIZE>
+class broadcast_ring
+{
+    static_assert(std::has_single_bit(SIZE), "broadcast_ring<T, SIZE>: SIZE must be a power of two");
+
+    // Elements are rebuilt from the words copied out of the arena.
+    static_assert(std::is_trivially_copyable_v<T>, "broadcast_ring<T, SIZE>: T must be trivially copyable");
+
+    public:
+    using size_type      = size_t;
+    using iterator       = T*;
+    using const_iterator = const T*;
+
+    /// @brief Read position of one reader.
+    class cursor
+    {
+        friend broadcast_ring;
+
+        size_type _pos     = 0u;
+        size_type _dropped = 0u;
+
+        explicit constexpr cursor(const size_type pos) : _pos(pos) {}
+
+        public:
+        /// @brief Amount of elements this reader missed by falling behind.
+        constexpr auto get_dropped() const -> size_type { return this->_dropped; }
+    };
+
+    /// @brief Creates a reader cursor, it sees elements written from now on.
+    auto subscribe() const -> cursor { return cursor{this->_head.load(std::memory_order_acquire)}; }
+
+    /// @brief Appends `n` elements, overwriting the oldest ones. Writer only.
+    void write(const_iterator data, size_type n)
+    {
+        size_type head = this->_head.load(std::memory_order_relaxed);
+
+        // Only the newest SIZE elements could be read by anyone.
+        if (n > SIZE)
+        {
+            data += n - SIZE;
+            head += n - SIZE;
+            n = SIZE;
+        }
+
+        // Announce which elements are about to be overwritten before touching
+        // them, so readers can tell if a copy raced with this write.
+        this->_claim.store(head + n, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        const size_type pos         = head & MASK;
+        const size_type first_chunk = std::min(n, SIZE - pos);
+
+        this->store_elements(data, first_chunk, pos);
+        this->store_elements(data + first_chunk, n - first_chunk, 0u);
+
+        this->_head.store(head + n, std::memory_order_release);
+    }
+
+    /// @brief Copies up to `n` elements not yet seen by `c`, oldest first.
+    /// @return Amount of elements read.
+    auto read(cursor &c, iterator dest, size_type n) const -> size_type
+    {
+        for (;;)
+        {
+            const size_type head = this->_head.load(std::memory_order_acquire);
+            this->skip_overrun(c, head);
+
+            const size_type count       = std::min(n, head - c._pos);
+            const size_type pos         = c._pos & MASK;
+            const size_type first_chunk = std::min(count, SIZE - pos);
+
+            this->load_elements(pos, first_chunk, dest);
+            this->load_elements(0u, count - first_chunk, dest + first_chunk);
+
+            // Pairs with the writer's release fence: if any copied element
+            // was being overwritten, the matching claim is visible here.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const size_type claim = this->_claim.load(std::memory_order_relaxed);
+
+            if (claim - c._pos <= SIZE)
+            {
+                c._pos += count;
+                return count;
+            }
+
+            // The writer lapped us during the copy, retry from the oldest
+            // element that is still intact.
+            this->skip_overrun(c, claim);
+        }
+    }
+
+    /// @brief Amount of elements `c` can read (capped to SIZE).
+    auto get_available(const cursor &c) const -> size_type
+    {
+        return std::min(this->_head.load(std::memory_order_acquire) - c._pos, SIZE);
+    }
+
+    private:
+    static constexpr size_type MASK = SIZE - 1u;
+
+    // Largest word dividing sizeof(T), so elements need no padding.
+    using word = std::conditional_t<
+        sizeof(T) % sizeof(uintptr_t) == 0u, uintptr_t,
+        std::conditional_t<sizeof(T) % sizeof(uint32_t) == 0u, uint32_t,
+                           std::conditional_t<sizeof(T) % sizeof(uint16_t) == 0u, uint16_t, uint8_t>>>;
+
+    static_assert(std::atomic_ref<word>::is_always_lock_free, "broadcast_ring<T, SIZE>: needs lock-free word atomics");
+
+    static constexpr size_type WORDS = sizeof(T) / sizeof(word);
+
+    /// @brief Copies `n` elements into the arena, starting at element `pos`.
+    void store_elements(const T *src, const size_type n, const size_type pos)
+    {
+        for (size_type i = 0u; i < n; ++i)
+        {
+            word tmp[WORDS];
+            std::memcpy(tmp, src + i, sizeof(T));
+
+            word *dst = this->_arena + (pos + i) * WORDS;
+            for (size_type w = 0u; w < WORDS; ++w)
+            {
+                std::atomic_ref<word>{dst[w]}.store(tmp[w], std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Copies `n` elements out of the arena, starting at element `pos`.
+    void load_elements(const size_type pos, const size_type n, T *dest) const
+    {
+        for (size_type i = 0u; i < n; ++i)
+        {
+            word tmp[WORDS];
+
+            word *src = this->_arena + (pos + i) * WORDS;
+            for (size_type w = 0u; w < WORDS; ++w)
+            {
+                tmp[w] = std::atomic_ref<word>{src[w]}.load(std::memory_order_relaxed);
+            }
+
+            std::memcpy(dest + i, tmp, sizeof(T));
+        }
+    }
+
+    /// @brief Moves `c` past elements that `head` has already overwritten.
+    static void skip_overrun(cursor &c, const size_type head)
+    {
+        if (head - c._pos > SIZE)
+        {
+            c._dropped += head - c._pos - SIZE;
+            c._pos = head - SIZE;
+        }
+    }
+
+    //! Elements published to readers.
+    alignas(cache_line_size) std::atomic<size_type> _head{0};
+    //! Elements the writer started overwriting, >= `_head`.
+    std::atomic<size_type> _claim{0};
+
+    //! Elements, only accessed through `std::atomic_ref` (mutable for the
+    //! readers' loads).
+    alignas(cache_line_size) mutable word _arena[SIZE * WORDS]{};
+};
+}
+
+#endif
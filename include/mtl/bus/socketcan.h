@@ -0,0 +1,317 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file socketcan.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Linux SocketCAN (CAN_RAW) bus.
+///
+/// Provides `write(m)`/`read(m)` for `can::message` and `can::frame`, and
+/// batched `write_bulk()`/`read_bulk()` moving many frames per system call
+/// (sendmmsg/recvmmsg). Received frames can carry kernel and hardware
+/// timestamps (SO_TIMESTAMPING), and `set_filters()` installs acceptance
+/// filters in the kernel, so unwanted frames never reach user space.
+///
+/// @code
+/// auto bus = mtl::bus::socketcan<>::open("can0");
+/// if (!bus) { ... }
+///
+/// std::array<mtl::can::frame, 64>         frames;
+/// std::array<mtl::bus::rx_timestamp, 64> stamps;
+///
+/// const size_t n = bus->read_bulk(frames, stamps);
+/// @endcode
+///
+/// Any socket exchanging `struct can_frame` sized datagrams can be adopted
+/// with the fd constructor, e.g. one end of a SOCK_SEQPACKET socketpair to
+/// stand in for a CAN interface in tests.
+///
+/// Failures are reported by return values, `errno` tells why.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_BUS_SOCKETCAN_H
+#define MTL_BUS_SOCKETCAN_H
+
+#include <span>
+#include <chrono>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+
+#include <net/if.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
+
+#include "../bus.h"
+#include "../option.h"
+#include "../interface/can.h"
+
+namespace mtl::bus
+{
+static_assert(sizeof(can::frame) == sizeof(struct can_frame), "can::frame must match struct can_frame");
+static_assert(offsetof(can::frame, _data) == offsetof(struct can_frame, data), "can::frame must match struct can_frame");
+static_assert(sizeof(can::filter) == sizeof(struct can_filter), "can::filter must match struct can_filter");
+static_assert(can::inv_filter == CAN_INV_FILTER, "can::inv_filter must match CAN_INV_FILTER");
+
+/// @brief Reception time of a frame, zero when not available.
+struct rx_timestamp
+{
+    //! Taken by the kernel when the frame was received (CLOCK_REALTIME).
+    std::chrono::nanoseconds _software{};
+    //! Taken by the CAN controller, if it supports it (its own clock).
+    std::chrono::nanoseconds _hardware{};
+};
+
+template <strategy Strategy = strategy::blocking>
+class socketcan
+{
+    static constexpr bool BLOCKING = Strategy == strategy::blocking;
+
+    public:
+    using size_type = size_t;
+
+    /// @brief Opens a raw CAN socket bound to interface `ifname` (e.g. "can0",
+    /// "vcan0"), with RX timestamps enabled when supported.
+    /// @return none when the socket could not be created or bound.
+    static auto open(const char *ifname) -> option<socketcan>
+    {
+        const int fd = ::socket(PF_CAN, SOCK_RAW | SOCK_CLOEXEC | (BLOCKING ? 0 : SOCK_NONBLOCK), CAN_RAW);
+        if (fd < 0)
+        {
+            return none;
+        }
+
+        socketcan bus{fd};
+
+        struct ifreq ifr{};
+        std::strncpy(ifr.ifr_name, ifname, IFNAMSIZ - 1u);
+        if (::ioctl(fd, SIOCGIFINDEX, &ifr) < 0)
+        {
+            return none;
+        }
+
+        struct sockaddr_can addr{};
+        addr.can_family  = AF_CAN;
+        addr.can_ifindex = ifr.ifr_ifindex;
+        if (::bind(fd, reinterpret_cast<const struct sockaddr *>(&addr), sizeof(addr)) < 0)
+        {
+            return none;
+        }
+
+        // Best effort, timestamps stay zero where unsupported.
+        const int ts = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_RX_HARDWARE |
+                       SOF_TIMESTAMPING_RAW_HARDWARE;
+        (void)::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &ts, sizeof(ts));
+
+        return bus;
+    }
+
+    /// @brief Takes ownership of an open socket.
+    explicit socketcan(const int fd) : _fd(fd) {}
+
+    socketcan(const socketcan &)            = delete;
+    socketcan &operator=(const socketcan &) = delete;
+
+    socketcan(socketcan &&other) noexcept : _fd(std::exchange(other._fd, -1)) {}
+
+    socketcan &operator=(socketcan &&other) noexcept
+    {
+        if (this != &other)
+        {
+            this->close();
+            this->_fd = std::exchange(other._fd, -1);
+        }
+
+        return *this;
+    }
+
+    ~socketcan() { this->close(); }
+
+    auto get_fd() const -> int { return this->_fd; }
+
+    /// @brief Installs kernel acceptance filters, replacing the current ones.
+    /// An empty list blocks every frame.
+    auto set_filters(const std::span<const can::filter> filters) -> bool
+    {
+        return ::setsockopt(this->_fd, SOL_CAN_RAW, CAN_RAW_FILTER, filters.data(),
+                            static_cast<socklen_t>(filters.size_bytes())) == 0;
+    }
+
+    /// @brief Lets every frame through (the default after open()).
+    auto clear_filters() -> bool
+    {
+        constexpr can::filter all{0u, 0u};
+        return this->set_filters({&all, 1u});
+    }
+
+    auto write(const can::frame &f) -> bool
+    {
+        return ::send(this->_fd, &f, sizeof(f), BLOCKING ? 0 : MSG_DONTWAIT) == static_cast<ssize_t>(sizeof(f));
+    }
+
+    auto write(const can::message &m) -> bool { return this->write(can::frame{m}); }
+
+    auto read(can::frame &f) -> bool
+    {
+        return ::recv(this->_fd, &f, sizeof(f), BLOCKING ? 0 : MSG_DONTWAIT) == static_cast<ssize_t>(sizeof(f));
+    }
+
+    auto read(can::message &m) -> bool
+    {
+        can::frame f;
+        if (!this->read(f))
+        {
+            return false;
+        }
+
+        m = f.to_message();
+        return true;
+    }
+
+    /// @brief Sends `frames` with as few system calls as possible. Blocking
+    /// buses wait for room in the socket buffer for every frame.
+    /// @return Amount of frames sent, they are sent in order.
+    auto write_bulk(const std::span<const can::frame> frames) -> size_type
+    {
+        size_type sent = 0u;
+
+        while (sent < frames.size())
+        {
+            const size_type n = std::min(frames.size() - sent, BATCH);
+
+            struct iovec   iov[BATCH];
+            struct mmsghdr msgs[BATCH]{};
+            for (size_type i = 0u; i < n; ++i)
+            {
+                iov[i]                     = {const_cast<can::frame *>(&frames[sent + i]), sizeof(can::frame)};
+                msgs[i].msg_hdr.msg_iov    = &iov[i];
+                msgs[i].msg_hdr.msg_iovlen = 1u;
+            }
+
+            const int r = ::sendmmsg(this->_fd, msgs, static_cast<unsigned>(n), BLOCKING ? 0 : MSG_DONTWAIT);
+            if (r <= 0)
+            {
+                break;
+            }
+
+            sent += static_cast<size_type>(r);
+            if (static_cast<size_type>(r) < n)
+            {
+                break;
+            }
+        }
+
+        return sent;
+    }
+
+    /// @brief Receives up to `frames.size()` frames with as few system calls
+    /// as possible. Blocking buses wait for the first frame only.
+    ///
+    /// @param stamps Reception time of every frame read, may be shorter than
+    /// `frames` (or empty) when not needed.
+    /// @return Amount of frames read.
+    auto read_bulk(const std::span<can::frame> frames, const std::span<rx_timestamp> stamps = {}) -> size_type
+    {
+        size_type got = 0u;
+
+        while (got < frames.size())
+        {
+            const size_type n = std::min(frames.size() - got, BATCH);
+
+            struct iovec   iov[BATCH];
+            struct mmsghdr msgs[BATCH]{};
+            alignas(struct cmsghdr) unsigned char control[BATCH][CONTROL_SIZE];
+
+            for (size_type i = 0u; i < n; ++i)
+            {
+                iov[i]                     = {&frames[got + i], sizeof(can::frame)};
+                msgs[i].msg_hdr.msg_iov    = &iov[i];
+                msgs[i].msg_hdr.msg_iovlen = 1u;
+
+                if (got + i < stamps.size())
+                {
+                    msgs[i].msg_hdr.msg_control    = control[i];
+                    msgs[i].msg_hdr.msg_controllen = CONTROL_SIZE;
+                }
+            }
+
+            // Only the first call may block, then take what is queued.
+            const int flags = BLOCKING && got == 0u ? MSG_WAITFORONE : MSG_DONTWAIT;
+            const int r     = ::recvmmsg(this->_fd, msgs, static_cast<unsigned>(n), flags, nullptr);
+            if (r <= 0)
+            {
+                break;
+            }
+
+            for (size_type i = 0u; i < static_cast<size_type>(r); ++i)
+            {
+                if (got + i < stamps.size())
+                {
+                    stamps[got + i] = get_timestamp(msgs[i].msg_hdr);
+                }
+            }
+
+            got += static_cast<size_type>(r);
+            if (static_cast<size_type>(r) < n)
+            {
+                break;
+            }
+        }
+
+        return got;
+    }
+
+    private:
+    //! Frames per sendmmsg/recvmmsg call.
+    static constexpr size_type BATCH        = 32u;
+    static constexpr size_type CONTROL_SIZE = CMSG_SPACE(sizeof(struct scm_timestamping));
+
+    static auto to_ns(const struct timespec &ts) -> std::chrono::nanoseconds
+    {
+        return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+    }
+
+    static auto get_timestamp(struct msghdr &hdr) -> rx_timestamp
+    {
+        rx_timestamp stamp;
+
+        for (struct cmsghdr *c = CMSG_FIRSTHDR(&hdr); c != nullptr; c = CMSG_NXTHDR(&hdr, c))
+        {
+            if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SO_TIMESTAMPING)
+            {
+                struct scm_timestamping ts;
+                std::memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+
+                stamp._software = to_ns(ts.ts[0]);
+                stamp._hardware = to_ns(ts.ts[2]);
+            }
+        }
+
+        return stamp;
+    }
+
+    void close()
+    {
+        if (this->_fd >= 0)
+        {
+            ::close(this->_fd);
+            this->_fd = -1;
+        }
+    }
+
+    int _fd = -1;
+};
+}
+
+#endif
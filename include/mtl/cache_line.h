@@ -0,0 +1,31 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file cache_line.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_CACHE_LINE_H
+#define MTL_CACHE_LINE_H
+
+#include <cstddef>
+
+/// Override with the target's L1 line size when it differs from 64 bytes
+/// (e.g. 32 on Cortex-M7, 128 on Apple M-series).
+#ifndef MTL_CACHE_LINE_SIZE
+#define MTL_CACHE_LINE_SIZE 64u
+#endif
+
+namespace mtl
+{
+/// @brief Minimum offset between two objects to avoid false sharing.
+/// @note `std::hardware_destructive_interference_size` is not used since its
+/// value may change between compiler versions, which breaks the ABI of any
+/// header that lays out members with it.
+inline constexpr size_t cache_line_size = MTL_CACHE_LINE_SIZE;
+}
+
+#endif
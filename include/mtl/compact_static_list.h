@@ -0,0 +1,289 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file compact_static_list.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Statically allocated double linked list with index links.
+///
+/// Same idea as `static_list`, but links are indices of the narrowest
+/// unsigned type able to address N nodes instead of pointers, and nodes are
+/// stored as separate value/next/prev arrays (structure of arrays). e.g. for
+/// N < 255 a node costs 2 bytes of links instead of 16 on a 64-bit target,
+/// and traversal only touches the small `_next` array.
+///
+/// Since no link points into the object itself, the list can be copied and
+/// moved as a plain value.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_COMPACT_STATIC_LIST_H
+#define MTL_COMPACT_STATIC_LIST_H
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include "type_traits.h"
+
+namespace mtl
+{
+template <typename T, size_t N> class compact_static_list;
+
+namespace compact_static_list_detail
+{
+    /// @brief Link type, N being the "null" link.
+    template <size_t N>
+    using index_type = least_index_t<N>;
+
+    // Iterator for this linked list.
+    // Can be used to traverse forwards and reverse.
+    template <typename T, size_t N, bool Const, bool Reverse = false> class compact_static_list_iterator
+    {
+        using list_type  = std::conditional_t<Const, const compact_static_list<T, N>, compact_static_list<T, N>>;
+        using value_type = std::conditional_t<Const, const T, T>;
+
+        list_type     *_list{nullptr};
+        index_type<N> _i{N};
+        friend compact_static_list<T, N>;
+
+        public:
+        constexpr value_type *operator->() const noexcept { return &this->_list->_values[this->_i]; }
+        constexpr value_type &operator*() const noexcept { return this->_list->_values[this->_i]; }
+
+        // Move to the next element in the list.
+        constexpr compact_static_list_iterator &operator++() noexcept
+        {
+            if (this->_i != N)
+            {
+                if constexpr (Reverse)
+                {
+                    this->_i = this->_list->_prev[this->_i];
+                }
+                else
+                {
+                    this->_i = this->_list->_next[this->_i];
+                }
+            }
+            return *this;
+        }
+
+        constexpr friend auto operator==(
+            const compact_static_list_iterator &lhs, const compact_static_list_iterator &rhs) -> bool
+        {
+            return lhs._i == rhs._i;
+        }
+
+        constexpr compact_static_list_iterator(list_type *list, const index_type<N> i) noexcept
+            : _list{list}, _i{i}
+        {
+        }
+    };
+} // namespace compact_static_list_detail
+
+// Statically allocated doubly linked list with index links.
+//
+// The interface follows static_list. As there, the list does not use C++
+// exceptions, using front()/back() on an empty list is undefined.
+template <typename T, size_t N> class compact_static_list
+{
+    static_assert(N > 0u, "compact_static_list<T, N>: N must be > 0");
+    static_assert(N < std::numeric_limits<uint32_t>::max(), "compact_static_list<T, N>: N too large");
+
+    template <bool Const, bool Reverse>
+    using iterator_type = compact_static_list_detail::compact_static_list_iterator<T, N, Const, Reverse>;
+
+    template <typename, size_t, bool, bool> friend class compact_static_list_detail::compact_static_list_iterator;
+
+    public:
+    using size_type       = size_t;
+    using index_type      = compact_static_list_detail::index_type<N>;
+    using iterator        = iterator_type<false, false>;
+    using const_iterator  = iterator_type<true, false>;
+    using riterator       = iterator_type<false, true>;
+    using const_riterator = iterator_type<true, true>;
+
+    private:
+    //! Link value meaning "no node".
+    static constexpr index_type NIL = static_cast<index_type>(N);
+
+    std::array<T, N>          _values{};
+    std::array<index_type, N> _next{};
+    std::array<index_type, N> _prev{};
+
+    //! The free elements, singly linked through `_next`. NIL when all elements reserved.
+    index_type _free = 0u;
+    //! Start of the list. NIL when empty.
+    index_type _first = NIL;
+    //! End of the list. NIL when empty.
+    index_type _last = NIL;
+
+    index_type _size = 0u;
+
+    /// @brief Get the next element in the free list, NIL when none available.
+    constexpr auto get_free_elem() -> index_type
+    {
+        const index_type elem = this->_free;
+        if (elem != NIL)
+        {
+            this->_free = this->_next[elem];
+        }
+
+        return elem;
+    }
+
+    /// @brief Return an element to the free list.
+    constexpr void return_free_elem(const index_type elem)
+    {
+        // Release whatever the value holds, the slot is not destroyed.
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            this->_values[elem] = T{};
+        }
+
+        this->_next[elem] = this->_free;
+        this->_free       = elem;
+    }
+
+    /// @brief Links `elem` before `pos` (NIL: at the end).
+    constexpr void link_before(const index_type pos, const index_type elem)
+    {
+        const index_type prev = pos == NIL ? this->_last : this->_prev[pos];
+
+        this->_prev[elem] = prev;
+        this->_next[elem] = pos;
+
+        if (prev != NIL) { this->_next[prev] = elem; }
+        else             { this->_first = elem; }
+
+        if (pos != NIL) { this->_prev[pos] = elem; }
+        else            { this->_last = elem; }
+
+        ++this->_size;
+    }
+
+    /// @brief Unlinks `elem` and returns it to the free list.
+    constexpr void unlink(const index_type elem)
+    {
+        const index_type next = this->_next[elem];
+        const index_type prev = this->_prev[elem];
+
+        if (prev != NIL) { this->_next[prev] = next; }
+        else             { this->_first = next; }
+
+        if (next != NIL) { this->_prev[next] = prev; }
+        else             { this->_last = prev; }
+
+        --this->_size;
+        this->return_free_elem(elem);
+    }
+
+    public:
+    /// @brief Forward iterator to start of list.
+    constexpr iterator begin() noexcept { return iterator(this, this->_first); }
+    /// @brief Forward iterator to end of list.
+    constexpr iterator end() noexcept { return iterator(this, NIL); }
+    /// @brief Constant forward iterator to start of list.
+    constexpr const_iterator begin() const noexcept { return const_iterator(this, this->_first); }
+    /// @brief Constant forward iterator to end of list.
+    constexpr const_iterator end() const noexcept { return const_iterator(this, NIL); }
+    /// @brief Constant forward iterator to start of list.
+    constexpr const_iterator cbegin() const noexcept { return const_iterator(this, this->_first); }
+    /// @brief Constant forward iterator to end of list.
+    constexpr const_iterator cend() const noexcept { return const_iterator(this, NIL); }
+    /// @brief Reverse iterator to start of list.
+    constexpr riterator rbegin() noexcept { return riterator(this, this->_last); }
+    /// @brief Reverse iterator to end of list.
+    constexpr riterator rend() noexcept { return riterator(this, NIL); }
+    /// @brief Constant reverse iterator to start of list.
+    constexpr const_riterator crbegin() const noexcept { return const_riterator(this, this->_last); }
+    /// @brief Constant reverse iterator to end of list.
+    constexpr const_riterator crend() const noexcept { return const_riterator(this, NIL); }
+
+    /// @brief Return a reference to the first element in the list.
+    constexpr T &front() noexcept { return this->_values[this->_first]; }
+
+    /// @brief Return a reference to the last element in the list.
+    constexpr T &back() noexcept { return this->_values[this->_last]; }
+
+    /// @brief Remove the first element in the list, return it to the free list.
+    constexpr void pop_front() noexcept
+    {
+        if (this->_first != NIL)
+        {
+            this->unlink(this->_first);
+        }
+    }
+
+    /// @brief Remove the last element in the list, return it to the free list.
+    constexpr void pop_back() noexcept
+    {
+        if (this->_last != NIL)
+        {
+            this->unlink(this->_last);
+        }
+    }
+
+    /// @brief Test for an empty list.
+    [[nodiscard]] constexpr bool empty() const { return this->_first == NIL; }
+
+    /// @brief Test for a list with no free element left.
+    [[nodiscard]] constexpr bool full() const { return this->_free == NIL; }
+
+    /// @brief Amount of elements in the list.
+    constexpr size_type size() const { return this->_size; }
+
+    /// @brief Instanciate an element before the iterator position in the list,
+    /// constructed in place of the (destroyed) free element of its slot.
+    /// Nothing happens when the list is full.
+    ///
+    /// @tparam Args Argument types to forward to the constructor of T.
+    /// @param i Iterator position to insert before. Use end() to insert at the end of the list.
+    /// @param args Arguments to forward to the constructor of T.
+    template <typename... Args> constexpr void emplace(const_iterator i, Args &&...args)
+    {
+        if (const index_type elem = this->get_free_elem(); elem != NIL)
+        {
+            T *value = &this->_values[elem];
+            std::destroy_at(value);
+            std::construct_at(value, std::forward<Args>(args)...);
+            this->link_before(i._i, elem);
+        }
+    }
+
+    template <typename... Args> constexpr void emplace(iterator i, Args &&...args)
+    {
+        this->emplace(const_iterator(this, i._i), std::forward<Args>(args)...);
+    }
+
+    /// @brief Instanciate an element at the last place in the list.
+    template <typename... Args> constexpr void emplace_back(Args &&...args)
+    {
+        this->emplace(this->cend(), std::forward<Args>(args)...);
+    }
+
+    constexpr void push_back(const T &value) { this->emplace_back(value); }
+    constexpr void push_back(T &&value) { this->emplace_back(std::move(value)); }
+
+    /// @brief Erase at iterator position.
+    constexpr void erase(const_iterator i) { this->unlink(i._i); }
+    constexpr void erase(iterator i) { this->unlink(i._i); }
+
+    /// @brief Construct a new list.
+    constexpr compact_static_list() noexcept
+    {
+        for (size_t i = 0u; i < N; ++i)
+        {
+            this->_next[i] = static_cast<index_type>(i + 1u);
+        }
+    }
+};
+} // namespace mtl
+
+#endif
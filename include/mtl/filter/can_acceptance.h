@@ -0,0 +1,377 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file can_acceptance.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief CAN acceptance filter compiled into lookup tables.
+///
+/// Takes up to N rules, either SocketCAN style (id, mask) filters or id
+/// ranges, and `compile()`s them into:
+///
+/// - a 2048 bit map answering for every 11-bit data frame in one load;
+/// - for other frames, the filters grouped by mask, each group a sorted
+///   array of `id & mask` searched in O(log n), plus the ranges merged and
+///   sorted, also binary searched.
+///
+/// Filters follow the kernel's rules (`(id & mask) == (filter id & mask)`
+/// on ids carrying the eff/rtr flags, `can::inv_filter` inverts), so
+/// `to_kernel()` can hand the same rules to `socketcan::set_filters()`.
+/// Like the kernel, a filter whose id lacks `eff_flag` while its mask has it
+/// only looks at the 11-bit id and flags, and a mask with `err_flag` makes an
+/// error frame filter: it passes error frames sharing a bit with the mask's
+/// error class bits, and never data frames. Data filters never pass error
+/// frames.
+///
+/// @code
+/// mtl::filter::can_acceptance<16> rx;
+///
+/// rx.add(can::filter{0x100u, 0x700u});                 // 0x100..0x1ff, both formats
+/// rx.add({0x18fef100u, 0x18fef1ffu, true});             // extended range
+/// rx.compile();
+///
+/// if (rx.matches(frame)) { ... }
+/// @endcode
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_FILTER_CAN_ACCEPTANCE_H
+#define MTL_FILTER_CAN_ACCEPTANCE_H
+
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "../interface/can.h"
+
+namespace mtl::filter
+{
+template <size_t N>
+class can_acceptance
+{
+    static_assert(N > 0u, "can_acceptance<N>: N must be > 0");
+
+    public:
+    using size_type = size_t;
+    using id_type   = can::id_type;
+
+    /// @brief Accepts ids from `_first` to `_last` (inclusive) of one frame
+    /// format, data and remote frames alike.
+    struct range
+    {
+        id_type _first    = 0u;
+        id_type _last     = 0u;
+        bool    _extended = false;
+    };
+
+    constexpr can_acceptance() = default;
+
+    /// @return false when N rules were added already.
+    constexpr auto add(const can::filter &f) -> bool
+    {
+        if (this->_filter_count + this->_range_count == N)
+        {
+            return false;
+        }
+
+        this->_filters[this->_filter_count++] = normalize(f);
+        return true;
+    }
+
+    constexpr auto add(const range &r) -> bool
+    {
+        if (this->_filter_count + this->_range_count == N || r._first > r._last)
+        {
+            return false;
+        }
+
+        this->_ranges[this->_range_count++] = r;
+        return true;
+    }
+
+    /// @brief Removes every rule, nothing matches after `compile()`.
+    constexpr void clear()
+    {
+        this->_filter_count = 0u;
+        this->_range_count  = 0u;
+    }
+
+    /// @brief Rebuilds the lookup tables, call after adding rules.
+    constexpr void compile()
+    {
+        this->compile_groups();
+        this->compile_ranges();
+
+        // Every SFF data frame id, with the tables above.
+        this->_sff = {};
+        for (id_type id = 0u; id <= can::sff_mask; ++id)
+        {
+            if (this->lookup(id))
+            {
+                this->_sff[id / 32u] |= 1u << (id % 32u);
+            }
+        }
+    }
+
+    /// @param id Identifier with flags, as in `can::frame::_id`.
+    constexpr auto matches(const id_type id) const -> bool
+    {
+        if ((id & can::err_flag) != 0u)
+        {
+            return this->lookup_error(id);
+        }
+
+        if (id <= can::sff_mask)
+        {
+            return (this->_sff[id / 32u] >> (id % 32u) & 1u) != 0u;
+        }
+
+        return this->lookup(id);
+    }
+
+    constexpr auto matches(const can::frame &f) const -> bool { return this->matches(f._id); }
+
+    constexpr auto matches(const can::message &m) const -> bool
+    {
+        return this->matches(m._extended ? (m._identifier & can::eff_mask) | can::eff_flag
+                                         : m._identifier & can::sff_mask);
+    }
+
+    /// @brief Writes kernel filters accepting the same frames, ranges being
+    /// split in aligned power of two blocks.
+    /// @return Amount of filters needed, only the ones fitting in `out` are
+    /// written.
+    constexpr auto to_kernel(const std::span<can::filter> out) const -> size_type
+    {
+        size_type n = 0u;
+        auto emit   = [&](const can::filter &f)
+        {
+            if (n < out.size()) { out[n] = f; }
+            ++n;
+        };
+
+        for (size_type i = 0u; i < this->_filter_count; ++i)
+        {
+            emit(this->_filters[i]);
+        }
+
+        for (size_type i = 0u; i < this->_range_count; ++i)
+        {
+            const range   &r    = this->_ranges[i];
+            const id_type  all  = r._extended ? can::eff_mask : can::sff_mask;
+            const id_type  flag = r._extended ? can::eff_flag : 0u;
+
+            for (uint64_t first = r._first; first <= r._last;)
+            {
+                // Largest block aligned on `first` that does not pass `_last`.
+                uint64_t size = first == 0u ? uint64_t{all} + 1u : first & (~first + 1u);
+                while (first + size - 1u > r._last)
+                {
+                    size /= 2u;
+                }
+
+                emit({static_cast<id_type>(first) | flag,
+                      (all & ~static_cast<id_type>(size - 1u)) | can::eff_flag});
+                first += size;
+            }
+        }
+
+        return n;
+    }
+
+    private:
+    /// @brief std::sort, except for N <= 16 where a plain insertion sort is
+    /// as fast and avoids GCC's false -Warray-bounds on std::sort's final
+    /// pass over arrays that short.
+    template <typename It, typename Less>
+    static constexpr void sort(const It first, const It last, const Less less)
+    {
+        if constexpr (N > 16u)
+        {
+            std::sort(first, last, less);
+        }
+        else
+        {
+            for (It i = first; i != last; ++i)
+            {
+                for (It j = i; j != first && less(*j, *(j - 1)); --j)
+                {
+                    std::iter_swap(j, j - 1);
+                }
+            }
+        }
+    }
+
+    static constexpr auto is_error_filter(const can::filter &f) -> bool { return (f._mask & can::err_flag) != 0u; }
+
+    /// @brief Applies the kernel's reductions (can_rcv_list_find()): SFF
+    /// filters drop the eff mask bits, the id is masked, inv_filter is kept.
+    static constexpr auto normalize(can::filter f) -> can::filter
+    {
+        if (is_error_filter(f))
+        {
+            return f;
+        }
+
+        if ((f._mask & can::eff_flag) != 0u && (f._id & can::eff_flag) == 0u)
+        {
+            f._mask &= can::sff_mask | can::eff_flag | can::rtr_flag;
+        }
+
+        return {(f._id & f._mask) | (f._id & can::inv_filter), f._mask};
+    }
+
+    /// @brief Matches a data frame id against a normalized data filter.
+    static constexpr auto filter_matches(const can::filter &f, const id_type id) -> bool
+    {
+        const bool hit = (id & f._mask) == (f._id & ~can::inv_filter);
+        return (f._id & can::inv_filter) != 0u ? !hit : hit;
+    }
+
+    // Ranges are ordered by (format, first id) through this key.
+    static constexpr auto range_key(const bool extended, const id_type id) -> uint64_t
+    {
+        return (uint64_t{extended} << 32u) | id;
+    }
+
+    /// @brief Sorts the plain filters by (mask, id & mask) and groups them
+    /// by mask, inverted ones are kept apart.
+    constexpr void compile_groups()
+    {
+        std::array<can::filter, N> plain{};
+        size_type                  count = 0u;
+
+        this->_inverted_count = 0u;
+        this->_error_mask     = 0u;
+        for (size_type i = 0u; i < this->_filter_count; ++i)
+        {
+            const can::filter &f = this->_filters[i];
+            if (is_error_filter(f))
+            {
+                this->_error_mask |= f._mask & can::err_mask;
+            }
+            else if ((f._id & can::inv_filter) != 0u)
+            {
+                this->_inverted[this->_inverted_count++] = f;
+            }
+            else
+            {
+                plain[count++] = f;
+            }
+        }
+
+        sort(plain.begin(), plain.begin() + count, [](const can::filter &a, const can::filter &b)
+                  { return a._mask != b._mask ? a._mask < b._mask : a._id < b._id; });
+
+        this->_group_count = 0u;
+        for (size_type i = 0u; i < count; ++i)
+        {
+            if (i == 0u || plain[i]._mask != plain[i - 1u]._mask)
+            {
+                this->_group_masks[this->_group_count++] = plain[i]._mask;
+            }
+
+            this->_values[i]                          = plain[i]._id;
+            this->_group_end[this->_group_count - 1u] = i + 1u;
+        }
+    }
+
+    /// @brief Sorts the ranges and merges the overlapping/adjacent ones.
+    constexpr void compile_ranges()
+    {
+        std::array<range, N> sorted{};
+        std::copy_n(this->_ranges.begin(), this->_range_count, sorted.begin());
+        sort(sorted.begin(), sorted.begin() + this->_range_count, [](const range &a, const range &b)
+                  { return range_key(a._extended, a._first) < range_key(b._extended, b._first); });
+
+        this->_merged_count = 0u;
+        for (size_type i = 0u; i < this->_range_count; ++i)
+        {
+            range *last = this->_merged_count != 0u ? &this->_merged[this->_merged_count - 1u] : nullptr;
+
+            if (last != nullptr && last->_extended == sorted[i]._extended &&
+                uint64_t{sorted[i]._first} <= uint64_t{last->_last} + 1u)
+            {
+                last->_last = std::max(last->_last, sorted[i]._last);
+            }
+            else
+            {
+                this->_merged[this->_merged_count++] = sorted[i];
+            }
+        }
+    }
+
+    /// @brief Error frames only pass error filters, on any common class bit.
+    constexpr auto lookup_error(const id_type id) const -> bool { return (id & this->_error_mask) != 0u; }
+
+    /// @brief Matches a data frame id against the compiled groups and ranges.
+    constexpr auto lookup(const id_type id) const -> bool
+    {
+        const auto *values = this->_values.data();
+        for (size_type g = 0u, begin = 0u; g < this->_group_count; begin = this->_group_end[g++])
+        {
+            if (std::binary_search(values + begin, values + this->_group_end[g], id & this->_group_masks[g]))
+            {
+                return true;
+            }
+        }
+
+        const bool     extended = (id & can::eff_flag) != 0u;
+        const id_type  plain    = id & (extended ? can::eff_mask : can::sff_mask);
+        const uint64_t key      = range_key(extended, plain);
+
+        // Last range starting at or before `id`.
+        const range *end  = this->_merged.data() + this->_merged_count;
+        const range *next = std::upper_bound(this->_merged.data(), end, key, [](const uint64_t k, const range &r)
+                                             { return k < range_key(r._extended, r._first); });
+        if (next != this->_merged.data())
+        {
+            const range &r = *(next - 1);
+            if (r._extended == extended && plain <= r._last)
+            {
+                return true;
+            }
+        }
+
+        for (size_type i = 0u; i < this->_inverted_count; ++i)
+        {
+            if (filter_matches(this->_inverted[i], id))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! Rules as added.
+    std::array<can::filter, N> _filters{};
+    std::array<range, N>       _ranges{};
+    size_type                  _filter_count = 0u;
+    size_type                  _range_count  = 0u;
+
+    //! Compiled: one bit per SFF data frame id.
+    std::array<uint32_t, (can::sff_mask + 1u) / 32u> _sff{};
+
+    //! Compiled: `id & mask` of the plain filters, sorted within mask groups.
+    std::array<id_type, N>   _values{};
+    std::array<id_type, N>   _group_masks{};
+    std::array<size_type, N> _group_end{};
+    size_type                _group_count = 0u;
+
+    std::array<range, N> _merged{};
+    size_type            _merged_count = 0u;
+
+    std::array<can::filter, N> _inverted{};
+    size_type                  _inverted_count = 0u;
+
+    //! Compiled: union of the error filters' class bits.
+    id_type _error_mask = 0u;
+};
+}
+
+#endif
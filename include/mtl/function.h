@@ -6,114 +6,208 @@
 /// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
 /// @date 20-03-2026
 ///
+/// @brief Type erased callable stored in place, in at most `Size` bytes.
+///
+/// Besides the storage, a function holds a single pointer to a static table
+/// with the target's call/move/copy/destroy operations, so moving runs the
+/// target's move constructor on sizeof(F) bytes only. A call loads the
+/// table entry and then calls through it.
+///
+/// `function<Size, R(Args...) const>` only accepts targets callable as
+/// const and can be called through a const reference.
+///
+/// Move-only targets are accepted, but as the target type is erased, copying
+/// a function holding one can only be caught at run time: it asserts, and
+/// gives an empty function when asserts are disabled. Calling an empty
+/// function asserts too.
+///
 ///-----------------------------------------------------------------------------
 
 #ifndef MTL_FUNCTION_H
 #define MTL_FUNCTION_H
 
 #include <new>
-#include <cstring>
+#include <cstddef>
+#include <cassert>
 #include <utility>
 #include <type_traits>
 
 namespace mtl
 {
-template<size_t Size, typename>
-class function;
-
-template<size_t Size, typename R, typename... Args>
-class function<Size, R(Args...)>
+namespace detail_function
 {
-    public:
-    function() = default;
+    /// @brief Operations on a target of type F, one static table per F and
+    /// signature.
+    template<bool Const, typename R, typename... Args>
+    struct ops
+    {
+        using storage_type = std::conditional_t<Const, const void*, void*>;
+
+        R (*_invoke)(storage_type data, Args... args);
+        //! Move constructs the target at `dst` from `src`, destroys `src`.
+        void (*_relocate)(void* dst, void* src);
+        //! Copy constructs the target at `dst`, nullptr for move-only targets.
+        void (*_copy)(void* dst, const void* src);
+        //! nullptr for trivially destructible targets.
+        void (*_destroy)(void* data);
+    };
+
+    template<typename F, bool Const, typename R, typename... Args>
+    inline constexpr ops<Const, R, Args...> ops_for{
+        [](typename ops<Const, R, Args...>::storage_type data, Args... args) -> R
+        {
+            using target = std::conditional_t<Const, const F, F>;
+            return (*static_cast<target*>(data))(std::forward<Args>(args)...);
+        },
+        [](void* dst, void* src)
+        {
+            F* f = static_cast<F*>(src);
+            new (dst) F(std::move(*f));
+            f->~F();
+        },
+        [] {
+            if constexpr (std::is_copy_constructible_v<F>)
+            {
+                return +[](void* dst, const void* src) { new (dst) F(*static_cast<const F*>(src)); };
+            }
+            else
+            {
+                return static_cast<void (*)(void*, const void*)>(nullptr);
+            }
+        }(),
+        [] {
+            if constexpr (!std::is_trivially_destructible_v<F>)
+            {
+                return +[](void* data) { static_cast<F*>(data)->~F(); };
+            }
+            else
+            {
+                return static_cast<void (*)(void*)>(nullptr);
+            }
+        }(),
+    };
 
-    template<typename F>
-    function(F f)
+    template<size_t Size, bool Const, typename R, typename... Args>
+    class function_base
     {
-        static_assert(sizeof(F) <= Size, "Callable too large");
-        static_assert(std::is_invocable_r_v<R, F&, Args...>,
-                      "Callable has incompatible signature");
+        using ops_type = ops<Const, R, Args...>;
 
-        new (this->_storage) F(std::move(f));
+        public:
+        function_base() = default;
 
-        this->_invoke = [](void* data, Args... args) -> R
+        template<typename F, typename D = std::decay_t<F>>
+            requires(!std::is_base_of_v<function_base, D>)
+        function_base(F&& f)
         {
-            return (*reinterpret_cast<F*>(data))(std::forward<Args>(args)...);
-        };
+            static_assert(sizeof(D) <= Size, "Callable too large");
+            static_assert(alignof(D) <= alignof(std::max_align_t), "Callable over-aligned");
+            static_assert(std::is_move_constructible_v<D>, "Callable must be move constructible");
+            static_assert(std::is_invocable_r_v<R, std::conditional_t<Const, const D&, D&>, Args...>,
+                          "Callable has incompatible signature");
+
+            new (this->_storage) D(std::forward<F>(f));
+            this->_ops = &ops_for<D, Const, R, Args...>;
+        }
 
-        if constexpr (!std::is_trivially_destructible_v<F>)
+        function_base(const function_base &other) { this->copy_from(other); }
+
+        function_base(function_base &&other) noexcept { this->move_from(std::move(other)); }
+
+        function_base& operator=(const function_base &other)
         {
-            _destroy = [](void* data)
+            if (this != &other)
             {
-                reinterpret_cast<F*>(data)->~F();
-            };
+                this->reset();
+                this->copy_from(other);
+            }
+
+            return *this;
         }
-        else
+
+        function_base& operator=(function_base &&other) noexcept
         {
-            _destroy = nullptr; // no-op
+            if (this != &other)
+            {
+                this->reset();
+                this->move_from(std::move(other));
+            }
+
+            return *this;
         }
-    }
 
-    function(const function&) = delete;
-    function& operator=(const function&) = delete;
+        ~function_base() { this->reset(); }
 
-    function(function &&other) noexcept
-    {
-        this->move_from(std::move(other));
-    }
+        explicit operator bool() const
+        {
+            return this->_ops != nullptr;
+        }
 
-    function& operator=(function &&other) noexcept
-    {
-        if (this != &other)
+        R operator()(Args... args)
+            requires(!Const)
         {
-            this->reset();
-            this->move_from(std::move(other));
+            assert(this->_ops != nullptr && "calling an empty mtl::function");
+            return this->_ops->_invoke(this->_storage, std::forward<Args>(args)...);
         }
 
-        return *this;
-    }
+        R operator()(Args... args) const
+            requires Const
+        {
+            assert(this->_ops != nullptr && "calling an empty mtl::function");
+            return this->_ops->_invoke(this->_storage, std::forward<Args>(args)...);
+        }
 
-    ~function() { this->reset(); }
+        void reset()
+        {
+            if (this->_ops != nullptr && this->_ops->_destroy != nullptr)
+            {
+                this->_ops->_destroy(this->_storage);
+            }
 
-    explicit operator bool() const
-    {
-        return this->_invoke != nullptr;
-    }
+            this->_ops = nullptr;
+        }
 
-    R operator()(Args... args)
-    {
-        return this->_invoke(this->_storage, std::forward<Args>(args)...);
-    }
+        private:
+        alignas(std::max_align_t) unsigned char _storage[Size];
 
-    void reset()
-    {
-        if (this->_destroy)
+        //! Operations of the target, nullptr when empty.
+        const ops_type* _ops = nullptr;
+
+        void move_from(function_base&& other)
         {
-            this->_destroy(_storage);
+            if (other._ops)
+            {
+                other._ops->_relocate(this->_storage, other._storage);
+                this->_ops = other._ops;
+                other._ops = nullptr;
+            }
         }
 
-        this->_invoke = nullptr;
-        this->_destroy = nullptr;
-    }
+        void copy_from(const function_base& other)
+        {
+            assert((!other._ops || other._ops->_copy) && "copying an mtl::function holding a move-only target");
 
-    private:
-    alignas(std::max_align_t) unsigned char _storage[Size];
+            if (other._ops && other._ops->_copy)
+            {
+                other._ops->_copy(this->_storage, other._storage);
+                this->_ops = other._ops;
+            }
+        }
+    };
+}
 
-    R (*_invoke)(void*, Args...) = nullptr;
-    void (*_destroy)(void*) = nullptr;
+template<size_t Size, typename>
+class function;
 
-    void move_from(function&& other)
-    {
-        if (other._invoke)
-        {
-            std::memcpy(_storage, other._storage, Size);
-            this->_invoke = other._invoke;
-            this->_destroy = other._destroy;
+template<size_t Size, typename R, typename... Args>
+class function<Size, R(Args...)> : public detail_function::function_base<Size, false, R, Args...>
+{
+    using detail_function::function_base<Size, false, R, Args...>::function_base;
+};
 
-            other._invoke = nullptr;
-            other._destroy = nullptr;
-        }
-    }
+template<size_t Size, typename R, typename... Args>
+class function<Size, R(Args...) const> : public detail_function::function_base<Size, true, R, Args...>
+{
+    using detail_function::function_base<Size, true, R, Args...>::function_base;
 };
 }
 
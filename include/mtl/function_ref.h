@@ -0,0 +1,101 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file function_ref.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Non-owning reference to a callable.
+///
+/// Two words (target address and call pointer), trivially copyable, never
+/// allocates. Lets non-template code take any callback without the storage
+/// of `mtl::function`:
+///
+/// @code
+/// void for_each_frame(mtl::function_ref<void(const can::message &)> fn);
+///
+/// for_each_frame([&](const can::message &m) { ++count; });
+/// @endcode
+///
+/// Like `std::string_view`, it does not extend the target's lifetime: a
+/// function_ref bound to a temporary lambda is only valid until the end of
+/// the full expression (fine for parameters, dangling if stored).
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_FUNCTION_REF_H
+#define MTL_FUNCTION_REF_H
+
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+namespace mtl
+{
+template<typename>
+class function_ref;
+
+template<typename R, typename... Args>
+class function_ref<R(Args...)>
+{
+    public:
+    /// @brief Refers to a function. The pointer itself is stored, so a
+    /// function pointer variable need not outlive the reference.
+    template<typename F>
+        requires std::is_function_v<F> && std::is_invocable_r_v<R, F&, Args...>
+    function_ref(F *f) noexcept
+    {
+        this->_target._fn = reinterpret_cast<void (*)()>(f);
+        this->_call       = [](target t, Args... args) -> R
+        {
+            return reinterpret_cast<F*>(t._fn)(std::forward<Args>(args)...);
+        };
+    }
+
+    /// @brief Refers to a callable object, which must outlive the reference.
+    template<typename F, typename T = std::remove_reference_t<F>>
+        requires(!std::is_same_v<std::remove_cv_t<T>, function_ref> && !std::is_pointer_v<T> &&
+                 std::is_invocable_r_v<R, T&, Args...>)
+    function_ref(F &&f) noexcept
+    {
+        if constexpr (std::is_function_v<T>)
+        {
+            this->_target._fn = reinterpret_cast<void (*)()>(&f);
+            this->_call       = [](target t, Args... args) -> R
+            {
+                return reinterpret_cast<T*>(t._fn)(std::forward<Args>(args)...);
+            };
+        }
+        else
+        {
+            this->_target._obj = const_cast<void*>(static_cast<const volatile void*>(std::addressof(f)));
+            this->_call        = [](target t, Args... args) -> R
+            {
+                return (*static_cast<T*>(t._obj))(std::forward<Args>(args)...);
+            };
+        }
+    }
+
+    function_ref(const function_ref&) = default;
+    function_ref& operator=(const function_ref&) = default;
+
+    R operator()(Args... args) const
+    {
+        return this->_call(this->_target, std::forward<Args>(args)...);
+    }
+
+    private:
+    // Object and function pointers may not convert to each other.
+    union target
+    {
+        void* _obj;
+        void (*_fn)();
+    };
+
+    target _target;
+    R (*_call)(target, Args...);
+};
+}
+
+#endif
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <algorithm>
+#include <type_traits>
 
 namespace mtl::can
 {
@@ -49,6 +50,17 @@ enum class speed : uint8_t
     can200_kbps,
     can250_kbps,
     can500_kbps,
+    can1000_kbps,
+};
+
+// CAN FD data phase bit rate, used when a frame has `fd_brs` set.
+enum class data_speed : uint8_t
+{
+    fd1_mbps,
+    fd2_mbps,
+    fd4_mbps,
+    fd5_mbps,
+    fd8_mbps,
 };
 
 // Data Length Code(DLC) is the standard term for CAN _data length.
@@ -65,18 +77,188 @@ struct message
 
     message() = default;
 
+    /// @brief Copies at most max_dlc bytes of `payload`.
     message(const id_type id, const bool ext, const size_t len, const data_type *payload)
-        : _identifier(id), _extended(ext), _dlc(len)
+        : _identifier(id), _extended(ext), _dlc(std::min(len, max_dlc))
     {
-        for(size_t i = 0; i < len; ++i) { this->_data[i] = payload[i]; }
+        std::copy_n(payload, this->_dlc, this->_data.begin());
     }
 
+    /// @brief Copies at most max_dlc bytes of `payload`.
     message(const id_type id, const bool ext, const std::span<const data_type> payload)
-        : _identifier(id), _extended(ext), _dlc(payload.size())
+        : _identifier(id), _extended(ext), _dlc(std::min(payload.size(), max_dlc))
     {
-        for(size_t i = 0; i < payload.size(); ++i) { this->_data[i] = payload[i]; }
+        std::copy_n(payload.begin(), this->_dlc, this->_data.begin());
     }
 };
+
+// Acceptance filter: a frame passes when (frame id & _mask) == (_id & _mask),
+// ids and masks include the eff/rtr flags. Layout of SocketCAN's `struct
+// can_filter`.
+struct filter
+{
+    id_type _id   = 0u;
+    id_type _mask = 0u;
+};
+
+// set in `filter::_id` to pass the frames NOT matching the filter
+[[maybe_unused]] inline static constexpr id_type inv_filter = 0x20000000UL;
+
+// CAN FD:
+
+// maximum payload length of a CAN FD frame.
+inline static constexpr size_type max_fd_len = 64u;
+
+// flags of `fd_frame::_flags`:
+
+// bit rate switch, the data phase runs at the data speed
+[[maybe_unused]] inline static constexpr data_type fd_brs = 0x01u;
+// error state indicator of the transmitting node
+[[maybe_unused]] inline static constexpr data_type fd_esi = 0x02u;
+// marks a CAN FD frame (as opposed to a classic one)
+[[maybe_unused]] inline static constexpr data_type fd_fdf = 0x04u;
+
+// Payload length of every DLC code.
+inline static constexpr std::array<data_type, 16> fd_dlc_len{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u,
+                                                             8u, 12u, 16u, 20u, 24u, 32u, 48u, 64u};
+
+constexpr auto dlc_to_len(const data_type dlc) -> size_type { return fd_dlc_len[dlc & 0x0fu]; }
+
+// Smallest DLC code holding `len` bytes, e.g. 9 -> 9 (12 bytes, padded).
+constexpr auto len_to_dlc(const size_type len) -> data_type
+{
+    data_type dlc = 0u;
+    while (dlc < 15u && fd_dlc_len[dlc] < len) { ++dlc; }
+
+    return dlc;
+}
+
+// Length a payload of `len` bytes is padded to on the wire.
+constexpr auto fd_padded_len(const size_type len) -> size_type { return dlc_to_len(len_to_dlc(len)); }
+
+// Frame with the layout of SocketCAN's `struct can_frame` (16 bytes), so
+// arrays of them can be read()/written to CAN sockets as they are.
+//
+// Unlike `message`, the frame format and RTR/ERR bits travel in `_id`
+// (see eff_flag, rtr_flag, err_flag).
+struct frame
+{
+    //! Identifier and eff/rtr/err flags.
+    id_type   _id       = 0u;
+    //! Payload length, 0..max_dlc.
+    data_type _len      = 0u;
+    data_type _pad      = 0u;
+    data_type _res0     = 0u;
+    //! Raw DLC (9..15) of 8 bytes payloads, 0 otherwise.
+    data_type _len8_dlc = 0u;
+
+    alignas(8) std::array<data_type, max_dlc> _data{};
+
+    constexpr frame() = default;
+
+    constexpr frame(const id_type id, const bool ext, const std::span<const data_type> payload)
+        : _id(ext ? (id & eff_mask) | eff_flag : id & sff_mask),
+          _len(static_cast<data_type>(std::min(payload.size(), max_dlc)))
+    {
+        std::copy_n(payload.begin(), this->_len, this->_data.begin());
+    }
+
+    constexpr explicit frame(const message &m)
+        : frame(m._identifier, m._extended, {m._data.data(), std::min(m._dlc, max_dlc)})
+    {
+    }
+
+    /// @brief Identifier without flags.
+    constexpr auto get_id() const -> id_type { return this->_id & (this->is_extended() ? eff_mask : sff_mask); }
+
+    constexpr auto is_extended() const -> bool { return (this->_id & eff_flag) != 0u; }
+    constexpr auto is_remote() const -> bool { return (this->_id & rtr_flag) != 0u; }
+    constexpr auto is_error() const -> bool { return (this->_id & err_flag) != 0u; }
+
+    constexpr auto payload() const -> std::span<const data_type> { return {this->_data.data(), this->_len}; }
+
+    auto to_message() const -> message { return message(this->get_id(), this->is_extended(), this->payload()); }
+};
+
+static_assert(sizeof(frame) == 16u, "can::frame must match struct can_frame");
+static_assert(alignof(frame) == 8u, "can::frame must match struct can_frame");
+static_assert(offsetof(frame, _data) == 8u, "can::frame must match struct can_frame");
+static_assert(std::is_trivially_copyable_v<frame>, "can::frame must be trivially copyable");
+
+// CAN FD frame holding up to `Capacity` payload bytes. With the default 64
+// it has the layout of SocketCAN's `struct canfd_frame` (72 bytes), smaller
+// capacities save memory for buses that never send long frames.
+template <size_type Capacity = max_fd_len>
+struct fd_frame
+{
+    static_assert(Capacity <= max_fd_len && fd_padded_len(Capacity) == Capacity,
+                  "fd_frame<Capacity>: Capacity must be a CAN FD payload length");
+
+    //! Identifier and eff/rtr/err flags.
+    id_type   _id    = 0u;
+    //! Payload length, one of `fd_dlc_len` up to Capacity.
+    data_type _len   = 0u;
+    //! fd_brs, fd_esi, fd_fdf. fd_fdf is clear for classic frames.
+    data_type _flags = 0u;
+    data_type _res0  = 0u;
+    data_type _res1  = 0u;
+
+    alignas(8) std::array<data_type, Capacity> _data{};
+
+    constexpr fd_frame() = default;
+
+    /// @brief Builds a CAN FD frame (fd_fdf is always set). Copies at most
+    /// Capacity bytes of `payload`, and zero pads them to the next valid
+    /// length.
+    constexpr fd_frame(const id_type id, const bool ext, const std::span<const data_type> payload,
+                       const data_type flags = 0u)
+        : _id(ext ? (id & eff_mask) | eff_flag : id & sff_mask), _flags(flags | fd_fdf)
+    {
+        this->assign(payload);
+    }
+
+    /// @brief Holds a classic frame: fd_fdf stays clear, so `is_fd()` still
+    /// tells it apart from a CAN FD frame with the same payload.
+    constexpr explicit fd_frame(const frame &f)
+        : _id(f._id)
+    {
+        this->assign(f.payload());
+    }
+
+    /// @brief Converts between capacities, truncating the payload if needed.
+    template <size_type C>
+    constexpr explicit fd_frame(const fd_frame<C> &f)
+        : _id(f._id), _flags(f._flags)
+    {
+        this->assign(f.payload());
+    }
+
+    /// @brief Replaces the payload (see constructor).
+    constexpr void assign(const std::span<const data_type> payload)
+    {
+        const size_type len = std::min(payload.size(), Capacity);
+        const size_type pad = fd_padded_len(len);
+
+        std::copy_n(payload.begin(), len, this->_data.begin());
+        std::fill_n(this->_data.begin() + len, pad - len, data_type{0u});
+
+        this->_len = static_cast<data_type>(pad);
+    }
+
+    constexpr auto get_id() const -> id_type { return this->_id & (this->is_extended() ? eff_mask : sff_mask); }
+    constexpr auto get_dlc() const -> data_type { return len_to_dlc(this->_len); }
+
+    constexpr auto is_extended() const -> bool { return (this->_id & eff_flag) != 0u; }
+    constexpr auto is_fd() const -> bool { return (this->_flags & fd_fdf) != 0u; }
+    constexpr auto is_brs() const -> bool { return (this->_flags & fd_brs) != 0u; }
+    constexpr auto is_esi() const -> bool { return (this->_flags & fd_esi) != 0u; }
+
+    constexpr auto payload() const -> std::span<const data_type> { return {this->_data.data(), this->_len}; }
+};
+
+static_assert(sizeof(fd_frame<>) == 72u, "can::fd_frame<> must match struct canfd_frame");
+static_assert(offsetof(fd_frame<>, _data) == 8u, "can::fd_frame<> must match struct canfd_frame");
+static_assert(std::is_trivially_copyable_v<fd_frame<>>, "can::fd_frame must be trivially copyable");
 }; // namespace trait::can
 
 #endif
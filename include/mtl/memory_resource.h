@@ -0,0 +1,115 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file memory_resource.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief `std::pmr::memory_resource` adapters for `mtl::pool` and
+/// `mtl::arena`, so STL containers can allocate from them.
+///
+/// Requests the pool or arena cannot serve (too large, over-aligned, or
+/// exhausted) go to an upstream resource. The default upstream is
+/// `std::pmr::null_memory_resource()`, which throws `std::bad_alloc`; pass
+/// another one to fall back to the heap.
+///
+/// @code
+/// mtl::pool<mtl::block<32>, 256> nodes;
+/// mtl::pool_resource             res{nodes};
+///
+/// std::pmr::list<can::message> backlog{&res};
+/// @endcode
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_MEMORY_RESOURCE_H
+#define MTL_MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "pool.h"
+#include "arena.h"
+
+namespace mtl
+{
+template <typename T, size_t N>
+class pool_resource : public std::pmr::memory_resource
+{
+    public:
+    explicit pool_resource(pool<T, N> &p, std::pmr::memory_resource *upstream = std::pmr::null_memory_resource())
+        : _pool(p), _upstream(upstream)
+    {
+    }
+
+    private:
+    auto do_allocate(const size_t bytes, const size_t align) -> void * override
+    {
+        if (bytes <= sizeof(T) && align <= alignof(T))
+        {
+            if (void *p = this->_pool.allocate(); p != nullptr)
+            {
+                return p;
+            }
+        }
+
+        return this->_upstream->allocate(bytes, align);
+    }
+
+    void do_deallocate(void *p, const size_t bytes, const size_t align) override
+    {
+        if (this->_pool.owns(p))
+        {
+            this->_pool.deallocate(static_cast<T *>(p));
+        }
+        else
+        {
+            this->_upstream->deallocate(p, bytes, align);
+        }
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override { return this == &other; }
+
+    pool<T, N>                 &_pool;
+    std::pmr::memory_resource *_upstream;
+};
+
+/// @note Deallocation is a no-op for arena memory, call `reset()` on the
+/// arena once nothing uses it anymore.
+template <size_t Size>
+class arena_resource : public std::pmr::memory_resource
+{
+    public:
+    explicit arena_resource(arena<Size> &a, std::pmr::memory_resource *upstream = std::pmr::null_memory_resource())
+        : _arena(a), _upstream(upstream)
+    {
+    }
+
+    private:
+    auto do_allocate(const size_t bytes, const size_t align) -> void * override
+    {
+        if (void *p = this->_arena.allocate(bytes, align); p != nullptr)
+        {
+            return p;
+        }
+
+        return this->_upstream->allocate(bytes, align);
+    }
+
+    void do_deallocate(void *p, const size_t bytes, const size_t align) override
+    {
+        if (!this->_arena.owns(p))
+        {
+            this->_upstream->deallocate(p, bytes, align);
+        }
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override { return this == &other; }
+
+    arena<Size>                &_arena;
+    std::pmr::memory_resource *_upstream;
+};
+}
+
+#endif
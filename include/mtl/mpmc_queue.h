@@ -0,0 +1,339 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file mpmc_queue.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Bounded multi-producer/multi-consumer queue.
+///
+/// Every slot carries a sequence number telling whether it is ready to be
+/// written (seq == pos) or read (seq == pos + 1) on the current lap, so
+/// producers and consumers only contend on their own position counter.
+/// (Dmitry Vyukov's bounded MPMC queue)
+///
+/// With `bus::strategy::blocking`, `enqueue()`/`dequeue()` sleep on a
+/// condition variable while the queue is full/empty, and `*_for()` variants
+/// take a timeout. Wake-ups are only signalled when someone is waiting, so
+/// the uncontended path stays lock-free.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_MPMC_QUEUE_H
+#define MTL_MPMC_QUEUE_H
+
+#include <bit>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <condition_variable>
+
+#include "bus.h"
+#include "option.h"
+#include "cache_line.h"
+
+namespace mtl
+{
+namespace detail_mpmc
+{
+    /// @brief One direction of blocking (e.g. "not empty").
+    class waiter
+    {
+        public:
+        /// @brief Wakes one waiter, if any. Call after publishing a change.
+        void notify()
+        {
+            // Orders the caller's publish before reading `_count`, pairs with
+            // the fence in `wait()` so either side sees the other's write.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (this->_count.load(std::memory_order_relaxed) != 0u)
+            {
+                // A waiter increments `_count` and tests its predicate with
+                // `_mutex` held, taking it here ensures it already sleeps.
+                {
+                    std::lock_guard lock(this->_mutex);
+                }
+
+                this->_cv.notify_one();
+            }
+        }
+
+        /// @brief Retries `attempt` until it succeeds or `deadline` expires.
+        template <typename Fn, typename Clock, typename Duration>
+        auto wait_until(Fn &&attempt, const std::chrono::time_point<Clock, Duration> &deadline) -> bool
+        {
+            std::unique_lock lock(this->_mutex);
+            this->enter();
+
+            const bool ok = this->_cv.wait_until(lock, deadline, attempt);
+
+            this->_count.fetch_sub(1u, std::memory_order_relaxed);
+            return ok;
+        }
+
+        /// @brief Retries `attempt` until it succeeds.
+        template <typename Fn>
+        void wait(Fn &&attempt)
+        {
+            std::unique_lock lock(this->_mutex);
+            this->enter();
+
+            this->_cv.wait(lock, attempt);
+
+            this->_count.fetch_sub(1u, std::memory_order_relaxed);
+        }
+
+        private:
+        void enter()
+        {
+            this->_count.fetch_add(1u, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        std::mutex              _mutex;
+        std::condition_variable _cv;
+        std::atomic<uint32_t>   _count{0};
+    };
+
+    template <bus::strategy Strategy>
+    struct waiters
+    {
+        void notify_not_empty() {}
+        void notify_not_full() {}
+    };
+
+    template <>
+    struct waiters<bus::strategy::blocking>
+    {
+        void notify_not_empty() { this->_not_empty.notify(); }
+        void notify_not_full() { this->_not_full.notify(); }
+
+        waiter _not_empty;
+        waiter _not_full;
+    };
+}
+
+template <typename T, size_t LEN, bus::strategy Strategy = bus::strategy::non_blocking>
+class mpmc_queue
+{
+    static_assert(std::has_single_bit(LEN), "mpmc_queue<T, LEN>: LEN must be a power of two");
+
+    static constexpr bool BLOCKING = Strategy == bus::strategy::blocking;
+
+    public:
+    using size_type       = size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+
+    mpmc_queue()
+    {
+        for (size_type i = 0u; i < LEN; ++i)
+        {
+            this->_slots[i]._seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_queue(const mpmc_queue &)            = delete;
+    mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+    /// @brief Enqueues without waiting, regardless of `Strategy`.
+    auto try_enqueue(const_reference data) -> bool { return this->pushed(this->push(data)); }
+    auto try_enqueue(T &&data) -> bool { return this->pushed(this->push(std::move(data))); }
+
+    /// @brief Dequeues without waiting, regardless of `Strategy`.
+    auto try_dequeue(reference data) -> bool { return this->popped(this->pop(data)); }
+
+    /// @brief Enqueues, waiting for room when `Strategy` is blocking.
+    auto enqueue(const_reference data) -> bool
+    {
+        if constexpr (BLOCKING)
+        {
+            this->_waiters._not_full.wait([&] { return this->push(data); });
+            return this->pushed(true);
+        }
+        else
+        {
+            return this->try_enqueue(data);
+        }
+    }
+
+    auto enqueue(T &&data) -> bool
+    {
+        if constexpr (BLOCKING)
+        {
+            this->_waiters._not_full.wait([&] { return this->push(std::move(data)); });
+            return this->pushed(true);
+        }
+        else
+        {
+            return this->try_enqueue(std::move(data));
+        }
+    }
+
+    /// @brief Dequeues, waiting for an element when `Strategy` is blocking.
+    auto dequeue(reference data) -> bool
+    {
+        if constexpr (BLOCKING)
+        {
+            this->_waiters._not_empty.wait([&] { return this->pop(data); });
+            return this->popped(true);
+        }
+        else
+        {
+            return this->try_dequeue(data);
+        }
+    }
+
+    auto dequeue() -> option<T>
+    {
+        if (T val; this->dequeue(val))
+        {
+            return std::move(val);
+        }
+
+        return none;
+    }
+
+    /// @brief Enqueues, waiting at most `timeout` for room.
+    template <typename Rep, typename Period>
+        requires BLOCKING
+    auto enqueue_for(const_reference data, const std::chrono::duration<Rep, Period> &timeout) -> bool
+    {
+        return this->pushed(
+            this->push(data) ||
+            this->_waiters._not_full.wait_until([&] { return this->push(data); },
+                                                std::chrono::steady_clock::now() + timeout));
+    }
+
+    /// @brief Dequeues, waiting at most `timeout` for an element.
+    template <typename Rep, typename Period>
+        requires BLOCKING
+    auto dequeue_for(reference data, const std::chrono::duration<Rep, Period> &timeout) -> bool
+    {
+        return this->popped(
+            this->pop(data) ||
+            this->_waiters._not_empty.wait_until([&] { return this->pop(data); },
+                                                 std::chrono::steady_clock::now() + timeout));
+    }
+
+    /// @note A snapshot, other threads may change it right after.
+    auto is_empty() const -> bool
+    {
+        const size_type pos = this->_dequeue_pos.load(std::memory_order_relaxed);
+        const size_type seq = this->_slots[pos & MASK]._seq.load(std::memory_order_acquire);
+
+        return seq != pos + 1u;
+    }
+
+    private:
+    static constexpr size_type MASK = LEN - 1u;
+
+    struct slot
+    {
+        std::atomic<size_type> _seq;
+        T                      _value{};
+    };
+
+    template <typename U>
+    auto push(U &&data) -> bool
+    {
+        slot     *cell = nullptr;
+        size_type pos  = this->_enqueue_pos.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            cell = &this->_slots[pos & MASK];
+
+            const size_type seq  = cell->_seq.load(std::memory_order_acquire);
+            const auto      diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (this->_enqueue_pos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The slot still holds last lap's element: full.
+                return false;
+            }
+            else
+            {
+                pos = this->_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->_value = std::forward<U>(data);
+        cell->_seq.store(pos + 1u, std::memory_order_release);
+
+        return true;
+    }
+
+    auto pop(reference data) -> bool
+    {
+        slot     *cell = nullptr;
+        size_type pos  = this->_dequeue_pos.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            cell = &this->_slots[pos & MASK];
+
+            const size_type seq  = cell->_seq.load(std::memory_order_acquire);
+            const auto      diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1u);
+
+            if (diff == 0)
+            {
+                if (this->_dequeue_pos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The slot has not been written on this lap yet: empty.
+                return false;
+            }
+            else
+            {
+                pos = this->_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        data = std::move(cell->_value);
+        cell->_seq.store(pos + LEN, std::memory_order_release);
+
+        return true;
+    }
+
+    // Wake-ups are sent by the callers of push()/pop() rather than by them,
+    // since push()/pop() also run as wait predicates with one waiter's mutex
+    // held, and notifying from there would take the opposite one.
+
+    auto pushed(const bool ok) -> bool
+    {
+        if (ok) { this->_waiters.notify_not_empty(); }
+        return ok;
+    }
+
+    auto popped(const bool ok) -> bool
+    {
+        if (ok) { this->_waiters.notify_not_full(); }
+        return ok;
+    }
+
+    alignas(cache_line_size) std::atomic<size_type> _enqueue_pos{0};
+    alignas(cache_line_size) std::atomic<size_type> _dequeue_pos{0};
+    alignas(cache_line_size) slot _slots[LEN];
+
+    [[no_unique_address]] detail_mpmc::waiters<Strategy> _waiters;
+};
+}
+
+#endif
@@ -0,0 +1,222 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file perfect_hash.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Minimal perfect hash over a fixed set of strings, built at compile
+/// time.
+///
+/// Maps each of N known keys to its position in the key list, with one
+/// fnv1a pass, one table probe and one string compare per lookup; any other
+/// string maps to `npos`. Built with "hash and displace" (CHD): keys are
+/// split in small buckets by hash, and every bucket gets a seed that sends
+/// all its keys to free slots.
+///
+/// @code
+/// constexpr mtl::perfect_hash nmea{"GGA", "RMC", "VTG", "HDT"};
+/// static_assert(nmea.is_valid(), "nmea: no perfect hash found");
+///
+/// switch (nmea.find(sentence_type))
+/// {
+///     case 0u: ...  // GGA
+///     case 1u: ...  // RMC
+///     ...
+///     default: ...  // unknown
+/// }
+/// @endcode
+///
+/// Building fails (`is_valid()` is false) for duplicate keys, or in the
+/// unlikely case no seed is found for some bucket.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_PERFECT_HASH_H
+#define MTL_PERFECT_HASH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include "hash.h"
+#include "string_view.h"
+#include "type_traits.h"
+
+namespace mtl
+{
+namespace detail_perfect_hash
+{
+    /// @brief Scrambles the key hash with a bucket seed (murmur3 finalizer).
+    constexpr auto mix(uint32_t h) -> uint32_t
+    {
+        h ^= h >> 16u;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13u;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16u;
+
+        return h;
+    }
+
+    //! Seeds tried per bucket before giving up.
+    inline constexpr uint32_t MAX_SEED = 1u << 16u;
+}
+
+template <size_t N>
+class perfect_hash
+{
+    static_assert(N > 0u, "perfect_hash<N>: N must be > 0");
+
+    public:
+    using size_type  = size_t;
+    using index_type = least_index_t<N>;
+
+    //! Result of `find()` for unknown keys.
+    static constexpr size_type npos = N;
+
+    constexpr explicit perfect_hash(const std::array<mtl::string_view, N> &keys) { this->build(keys); }
+
+    template <typename... Keys>
+        requires(sizeof...(Keys) == N && (std::is_constructible_v<mtl::string_view, const Keys &> && ...))
+    constexpr perfect_hash(const Keys &...keys)
+        : perfect_hash(std::array<mtl::string_view, N>{mtl::string_view(keys)...})
+    {
+    }
+
+    /// @brief false when the keys have no perfect hash (e.g. duplicates),
+    /// meant to be checked with static_assert.
+    constexpr auto is_valid() const -> bool { return this->_valid; }
+
+    /// @return Position of `key` in the list the table was built from,
+    /// `npos` when it is not one of them.
+    constexpr auto find(const mtl::string_view key) const -> size_type
+    {
+        const uint32_t  h    = fnv1a_32(key);
+        const size_type slot = slot_of(h, this->_seeds[h % BUCKETS]);
+
+        return this->_valid && this->_keys[slot] == key ? this->_index[slot] : npos;
+    }
+
+    constexpr auto contains(const mtl::string_view key) const -> bool { return this->find(key) != npos; }
+
+    static constexpr auto size() -> size_type { return N; }
+
+    private:
+    //! Average of two keys per bucket.
+    static constexpr size_type BUCKETS = (N + 1u) / 2u;
+
+    static constexpr auto slot_of(const uint32_t h, const uint32_t seed) -> size_type
+    {
+        return detail_perfect_hash::mix(h ^ seed) % N;
+    }
+
+    constexpr void build(const std::array<mtl::string_view, N> &keys)
+    {
+        std::array<uint32_t, N>        hashes{};
+        std::array<size_type, BUCKETS> sizes{};
+        std::array<size_type, BUCKETS> order{};
+        std::array<bool, N>            used{};
+
+        for (size_type i = 0u; i < N; ++i)
+        {
+            hashes[i] = fnv1a_32(keys[i]);
+            ++sizes[hashes[i] % BUCKETS];
+        }
+
+        // Largest buckets first, while most slots are still free.
+        for (size_type b = 0u; b < BUCKETS; ++b)
+        {
+            order[b] = b;
+        }
+        std::sort(order.begin(), order.end(),
+                  [&](const size_type a, const size_type b) { return sizes[a] > sizes[b]; });
+
+        for (const size_type b : order)
+        {
+            if (sizes[b] == 0u)
+            {
+                break;
+            }
+
+            std::array<size_type, N> members{};
+            size_type                count = 0u;
+            for (size_type i = 0u; i < N; ++i)
+            {
+                if (hashes[i] % BUCKETS == b) { members[count++] = i; }
+            }
+
+            if (!this->place(hashes, members, count, used, b))
+            {
+                return;
+            }
+
+            for (size_type m = 0u; m < count; ++m)
+            {
+                const size_type slot = slot_of(hashes[members[m]], this->_seeds[b]);
+
+                used[slot]         = true;
+                this->_keys[slot]  = keys[members[m]];
+                this->_index[slot] = static_cast<index_type>(members[m]);
+            }
+        }
+
+        this->_valid = true;
+    }
+
+    /// @brief Looks for a seed sending the `count` keys of bucket `b` to
+    /// distinct free slots.
+    constexpr auto place(const std::array<uint32_t, N> &hashes, const std::array<size_type, N> &members,
+                         const size_type count, const std::array<bool, N> &used, const size_type b) -> bool
+    {
+        // Keys with the same hash (e.g. duplicates) collide whatever the
+        // seed, don't bother searching.
+        for (size_type m = 1u; m < count; ++m)
+        {
+            for (size_type o = 0u; o < m; ++o)
+            {
+                if (hashes[members[m]] == hashes[members[o]])
+                {
+                    return false;
+                }
+            }
+        }
+
+        for (uint32_t seed = 0u; seed < detail_perfect_hash::MAX_SEED; ++seed)
+        {
+            bool fits = true;
+            for (size_type m = 0u; fits && m < count; ++m)
+            {
+                const size_type slot = slot_of(hashes[members[m]], seed);
+                fits                 = !used[slot];
+
+                for (size_type o = 0u; fits && o < m; ++o)
+                {
+                    fits = slot != slot_of(hashes[members[o]], seed);
+                }
+            }
+
+            if (fits)
+            {
+                this->_seeds[b] = seed;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::array<uint32_t, BUCKETS>   _seeds{};
+    std::array<mtl::string_view, N> _keys{};
+    std::array<index_type, N>       _index{};
+
+    bool _valid = false;
+};
+
+template <typename... Keys> perfect_hash(const Keys &...) -> perfect_hash<sizeof...(Keys)>;
+}
+
+#endif
@@ -0,0 +1,272 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file pool.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Statically allocated pool of N blocks for objects of type T.
+///
+/// Free blocks form a lock-free stack (Treiber) linked by index, so
+/// `allocate()`/`deallocate()` are O(1) and safe from any thread or ISR.
+/// The stack head packs the index with a counter bumped on every change,
+/// which keeps a thread that was preempted mid-pop from corrupting the
+/// stack if the block it saw is popped and pushed back meanwhile (ABA). The
+/// head is 32 bits wide for N < 65535, so it stays lock-free on 32-bit MCUs.
+///
+/// Threads allocating often can go through a `pool::cache`, which keeps a
+/// few free blocks at hand and returns them to the pool in batches.
+///
+/// @code
+/// mtl::pool<can::message, 64> frames;
+///
+/// can::message *m = frames.create(0x123u, false, payload);
+/// ...
+/// frames.destroy(m);
+/// @endcode
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_POOL_H
+#define MTL_POOL_H
+
+#include <new>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include "aligned_storage.h"
+
+namespace mtl
+{
+/// @brief Raw memory block, to pool storage for unknown types (e.g. behind
+/// a `pool_resource`).
+template <size_t Size, size_t Align = alignof(std::max_align_t)>
+struct block
+{
+    alignas(Align) std::byte _data[Size];
+};
+
+template <typename T, size_t N>
+class pool
+{
+    static_assert(N > 0u, "pool<T, N>: N must be > 0");
+    static_assert(N < UINT32_MAX, "pool<T, N>: N too large");
+
+    static constexpr bool NARROW = N < UINT16_MAX;
+
+    public:
+    using value_type = T;
+    using size_type  = size_t;
+    using index_type = std::conditional_t<NARROW, uint16_t, uint32_t>;
+
+    template <size_t K>
+    class cache;
+
+    pool()
+    {
+        for (size_type i = 0u; i < N; ++i)
+        {
+            this->_next[i].store(static_cast<index_type>(i + 1u), std::memory_order_relaxed);
+        }
+    }
+
+    pool(const pool &)            = delete;
+    pool &operator=(const pool &) = delete;
+
+    /// @return Uninitialized storage for one T, nullptr when exhausted.
+    auto allocate() -> T *
+    {
+        const index_type i = this->pop();
+        return i != NIL ? this->at(i) : nullptr;
+    }
+
+    /// @brief Returns a block obtained from `allocate()`. Does not run ~T.
+    void deallocate(T *p) { this->push(this->index_of(p), this->index_of(p)); }
+
+    /// @brief Allocates a block and constructs a T in it.
+    /// @return nullptr when exhausted.
+    template <typename... Args>
+    auto create(Args &&...args) -> T *
+    {
+        T *p = this->allocate();
+        if (p != nullptr)
+        {
+            new (p) T(std::forward<Args>(args)...);
+        }
+
+        return p;
+    }
+
+    /// @brief Destroys an object obtained from `create()` and frees its block.
+    void destroy(T *p)
+    {
+        p->~T();
+        this->deallocate(p);
+    }
+
+    /// @brief Tests if `p` points into this pool's storage.
+    auto owns(const void *p) const -> bool
+    {
+        const auto *b = static_cast<const unsigned char *>(p);
+        return b >= this->bytes() && b < this->bytes() + sizeof(this->_blocks);
+    }
+
+    static constexpr auto capacity() -> size_type { return N; }
+
+    private:
+    using head_type = std::conditional_t<NARROW, uint32_t, uint64_t>;
+
+    static constexpr index_type NIL  = static_cast<index_type>(N);
+    static constexpr unsigned   BITS = 8u * sizeof(index_type);
+
+    static constexpr auto index(const head_type h) -> index_type { return static_cast<index_type>(h); }
+    static constexpr auto pack(const index_type i, const head_type prev) -> head_type
+    {
+        // Bump the counter held in the upper half.
+        return ((prev >> BITS) + 1u) << BITS | i;
+    }
+
+    auto bytes() const -> const unsigned char * { return reinterpret_cast<const unsigned char *>(this->_blocks); }
+
+    auto at(const index_type i) -> T * { return this->_blocks[i].data(); }
+
+    auto index_of(const T *p) const -> index_type
+    {
+        return static_cast<index_type>((reinterpret_cast<const unsigned char *>(p) - this->bytes()) /
+                                       sizeof(aligned_storage<T>));
+    }
+
+    auto pop() -> index_type
+    {
+        head_type head = this->_head.load(std::memory_order_acquire);
+
+        for (;;)
+        {
+            const index_type i = index(head);
+            if (i == NIL)
+            {
+                return NIL;
+            }
+
+            // May read a link that is being rewritten if `i` is popped by
+            // someone else meanwhile, the counter then fails the exchange.
+            const index_type next = this->_next[i].load(std::memory_order_relaxed);
+
+            if (this->_head.compare_exchange_weak(head, pack(next, head), std::memory_order_acquire,
+                                                  std::memory_order_acquire))
+            {
+                return i;
+            }
+        }
+    }
+
+    /// @brief Pushes the chain `first`..`last`, already linked through `_next`.
+    void push(const index_type first, const index_type last)
+    {
+        head_type head = this->_head.load(std::memory_order_relaxed);
+
+        do
+        {
+            this->_next[last].store(index(head), std::memory_order_relaxed);
+        } while (!this->_head.compare_exchange_weak(head, pack(first, head), std::memory_order_release,
+                                                    std::memory_order_relaxed));
+    }
+
+    aligned_storage<T>      _blocks[N];
+    std::atomic<index_type> _next[N];
+
+    //! Top of the free stack (index in the lower half, counter in the upper).
+    std::atomic<head_type> _head{0u};
+};
+
+/// @brief Per-thread front end of a pool, holding up to K free blocks.
+///
+/// Serves allocations from its own blocks without touching the shared stack,
+/// and when full, returns half of them to the pool in a single exchange.
+/// Must only be used by one thread, gives its blocks back when destroyed.
+template <typename T, size_t N>
+template <size_t K>
+class pool<T, N>::cache
+{
+    static_assert(K >= 2u, "pool<T, N>::cache<K>: K must be >= 2");
+
+    public:
+    explicit cache(pool &p) : _pool(p) {}
+
+    cache(const cache &)            = delete;
+    cache &operator=(const cache &) = delete;
+
+    ~cache() { this->flush(this->_count); }
+
+    /// @return Uninitialized storage for one T, nullptr when exhausted.
+    auto allocate() -> T *
+    {
+        if (this->_count == 0u)
+        {
+            return this->_pool.allocate();
+        }
+
+        return this->_pool.at(this->_free[--this->_count]);
+    }
+
+    void deallocate(T *p)
+    {
+        if (this->_count == K)
+        {
+            this->flush(K / 2u);
+        }
+
+        this->_free[this->_count++] = this->_pool.index_of(p);
+    }
+
+    template <typename... Args>
+    auto create(Args &&...args) -> T *
+    {
+        T *p = this->allocate();
+        if (p != nullptr)
+        {
+            new (p) T(std::forward<Args>(args)...);
+        }
+
+        return p;
+    }
+
+    void destroy(T *p)
+    {
+        p->~T();
+        this->deallocate(p);
+    }
+
+    private:
+    /// @brief Returns the `n` oldest cached blocks to the pool.
+    void flush(const size_type n)
+    {
+        if (n == 0u)
+        {
+            return;
+        }
+
+        for (size_type i = 0u; i + 1u < n; ++i)
+        {
+            this->_pool._next[this->_free[i]].store(this->_free[i + 1u], std::memory_order_relaxed);
+        }
+        this->_pool.push(this->_free[0], this->_free[n - 1u]);
+
+        for (size_type i = n; i < this->_count; ++i)
+        {
+            this->_free[i - n] = this->_free[i];
+        }
+        this->_count -= n;
+    }
+
+    pool      &_pool;
+    index_type _free[K]{};
+    size_type  _count = 0u;
+};
+}
+
+#endif
@@ -0,0 +1,278 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file priority_queue.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Statically allocated priority queue (implicit d-ary heap).
+///
+/// Like `std::priority_queue`, the top is the greatest element according to
+/// `Compare`. e.g. to send CAN frames in bus arbitration order (lowest
+/// identifier first):
+///
+/// @code
+/// struct arbitration_order
+/// {
+///     auto operator()(const can::message &a, const can::message &b) const -> bool
+///     {
+///         return a._identifier > b._identifier;
+///     }
+/// };
+///
+/// mtl::static_priority_queue<can::message, 32, arbitration_order, 2u, ties::fifo> tx;
+/// @endcode
+///
+/// By default elements comparing equal come out in any order. `ties::fifo`
+/// makes them come out in push order, so frames sharing an identifier, e.g.
+/// the packets of a multi-frame transfer, keep their sequence. It costs a
+/// 64 bit push counter per element (8 bytes plus T's padding up to 8 byte
+/// alignment) and one more compare on ties.
+///
+/// `Arity` trades tree depth (log_D N levels on push) for compares per level
+/// on pop (D children). With small T, the children of a node share a cache
+/// line, so 4 is worth trying against the binary default.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_PRIORITY_QUEUE_H
+#define MTL_PRIORITY_QUEUE_H
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include "option.h"
+
+namespace mtl
+{
+// Order of elements comparing equal.
+enum class ties : uint8_t
+{
+    any,
+    fifo,
+};
+
+namespace detail_priority_queue
+{
+    template <typename T, ties Ties>
+    struct entry
+    {
+        T _value{};
+    };
+
+    template <typename T>
+    struct entry<T, ties::fifo>
+    {
+        T        _value{};
+        //! Push order, breaks ties between equal elements.
+        uint64_t _seq = 0u;
+    };
+
+    struct no_counter {};
+}
+
+template <typename T, size_t N, typename Compare = std::less<T>, size_t Arity = 2u, ties Ties = ties::any>
+class static_priority_queue
+{
+    static_assert(N > 0u, "static_priority_queue<T, N>: N must be > 0");
+    static_assert(Arity >= 2u, "static_priority_queue<T, N>: Arity must be >= 2");
+
+    public:
+    using size_type       = size_t;
+    using value_type      = T;
+    using reference       = T&;
+    using const_reference = const T&;
+
+    constexpr static_priority_queue() = default;
+    constexpr explicit static_priority_queue(const Compare &cmp) : _cmp(cmp) {}
+
+    constexpr auto size() const -> size_type { return this->_size; }
+    constexpr auto empty() const -> bool { return this->_size == 0u; }
+    constexpr auto full() const -> bool { return this->_size == N; }
+    static constexpr auto capacity() -> size_type { return N; }
+
+    constexpr void clear() { this->_size = 0u; }
+
+    /// @brief Greatest element.
+    /// @note Reads a stale or default element when the queue is empty.
+    constexpr auto top() const -> const_reference { return this->_data[0]._value; }
+
+    constexpr auto push(const_reference value) -> bool { return this->emplace(value); }
+    constexpr auto push(T &&value) -> bool { return this->emplace(std::move(value)); }
+
+    /// @return false when the queue is full.
+    template <typename... Args>
+    constexpr auto emplace(Args &&...args) -> bool
+    {
+        if (this->full())
+        {
+            return false;
+        }
+
+        this->sift_up(this->_size++, this->make_entry(T(std::forward<Args>(args)...)));
+        return true;
+    }
+
+    /// @brief Removes and returns the greatest element.
+    constexpr auto pop() -> option<T>
+    {
+        if (this->empty())
+        {
+            return none;
+        }
+
+        option<T> val{std::move(this->_data[0]._value)};
+
+        if (--this->_size != 0u)
+        {
+            this->sift_down(0u, std::move(this->_data[this->_size]));
+        }
+
+        return val;
+    }
+
+    /// @brief Pushes as many elements of `values` as fit.
+    ///
+    /// Large batches are appended unordered and the heap is rebuilt in O(N)
+    /// (Floyd), small ones are sifted up one by one in O(k log N).
+    ///
+    /// @return Amount of elements pushed.
+    constexpr auto push_bulk(const std::span<const T> values) -> size_type
+    {
+        const size_type n = std::min(values.size(), N - this->_size);
+
+        if (n > this->_size)
+        {
+            for (size_type i = 0u; i < n; ++i)
+            {
+                this->_data[this->_size++] = this->make_entry(T(values[i]));
+            }
+            this->heapify();
+        }
+        else
+        {
+            for (size_type i = 0u; i < n; ++i)
+            {
+                this->sift_up(this->_size++, this->make_entry(T(values[i])));
+            }
+        }
+
+        return n;
+    }
+
+    /// @brief Replaces the content with up to N elements of `values`, in O(N).
+    /// @return Amount of elements stored.
+    constexpr auto assign(const std::span<const T> values) -> size_type
+    {
+        this->clear();
+        return this->push_bulk(values);
+    }
+
+    private:
+    static constexpr bool FIFO = Ties == ties::fifo;
+
+    using entry = detail_priority_queue::entry<T, Ties>;
+
+    constexpr auto make_entry(T &&value) -> entry
+    {
+        if constexpr (FIFO) { return entry{std::move(value), this->_seq++}; }
+        else { return entry{std::move(value)}; }
+    }
+
+    /// @brief `a` goes out after `b`: lower by `Compare`, or (fifo) equal
+    /// and pushed later.
+    constexpr auto below(const entry &a, const entry &b) const -> bool
+    {
+        if (this->_cmp(a._value, b._value))
+        {
+            return true;
+        }
+
+        if constexpr (FIFO) { return !this->_cmp(b._value, a._value) && a._seq > b._seq; }
+        else { return false; }
+    }
+
+    static constexpr auto parent(const size_type i) -> size_type { return (i - 1u) / Arity; }
+    static constexpr auto first_child(const size_type i) -> size_type { return i * Arity + 1u; }
+
+    /// @brief Places `value` in the hole at `i`, moving it up while it beats its parent.
+    constexpr void sift_up(size_type i, entry value)
+    {
+        while (i > 0u)
+        {
+            const size_type p = parent(i);
+            if (!this->below(this->_data[p], value))
+            {
+                break;
+            }
+
+            this->_data[i] = std::move(this->_data[p]);
+            i              = p;
+        }
+
+        this->_data[i] = std::move(value);
+    }
+
+    /// @brief Places `value` in the hole at `i`, moving it down while a child beats it.
+    constexpr void sift_down(size_type i, entry value)
+    {
+        for (;;)
+        {
+            const size_type first = first_child(i);
+            if (first >= this->_size)
+            {
+                break;
+            }
+
+            const size_type last = std::min(first + Arity, this->_size);
+
+            size_type best = first;
+            for (size_type c = first + 1u; c < last; ++c)
+            {
+                if (this->below(this->_data[best], this->_data[c]))
+                {
+                    best = c;
+                }
+            }
+
+            if (!this->below(value, this->_data[best]))
+            {
+                break;
+            }
+
+            this->_data[i] = std::move(this->_data[best]);
+            i              = best;
+        }
+
+        this->_data[i] = std::move(value);
+    }
+
+    constexpr void heapify()
+    {
+        if (this->_size < 2u)
+        {
+            return;
+        }
+
+        for (size_type i = parent(this->_size - 1u) + 1u; i-- > 0u;)
+        {
+            this->sift_down(i, std::move(this->_data[i]));
+        }
+    }
+
+    entry     _data[N]{};
+    size_type _size = 0u;
+
+    [[no_unique_address]] std::conditional_t<FIFO, uint64_t, detail_priority_queue::no_counter> _seq{};
+
+    [[no_unique_address]] Compare _cmp{};
+};
+}
+
+#endif
@@ -0,0 +1,581 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file j1939.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief J1939 identifier fields and multi-packet reassembly (J1939-21
+/// transport protocol and NMEA 2000 fast packet).
+///
+/// `reassembler` takes every received frame and hands complete parameter
+/// groups to a callback: single frame PGNs straight from the frame, longer
+/// ones once all their packets arrived. In-flight transfers live in a fixed
+/// pool of sessions, keyed by sender and destination (TP, BAM and RTS/CTS)
+/// or by sender and PGN (fast packet), and are dropped when they time out.
+///
+/// @code
+/// auto deliver = [&](const j1939::packet &p) { decoders.emit(p._pgn, p); };
+/// auto is_fast = [](const j1939::pgn_type pgn) { return pgn == 129029u || ...; };
+///
+/// mtl::j1939::reassembler<16> rx{deliver, is_fast};
+///
+/// rx.on_frame(frame, now);  // every received can::frame or can::message
+/// rx.poll(now);             // periodically, expires stalled sessions
+/// @endcode
+///
+/// The callbacks are copied into the reassembler (`mtl::function`, at most
+/// `CallbackSize` bytes each), so temporary lambdas are fine; whatever they
+/// capture by reference must outlive it.
+///
+/// Connection mode (RTS/CTS) transfers between other nodes are followed
+/// passively. Given an own address and a send function, the reassembler
+/// also answers the ones addressed to it (CTS, end of message ack, abort).
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_PROTOCOL_J1939_H
+#define MTL_PROTOCOL_J1939_H
+
+#include <span>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <initializer_list>
+
+#include "../function.h"
+#include "../unordered_map.h"
+#include "../interface/can.h"
+#include "../type_traits.h"
+
+namespace mtl::j1939
+{
+using pgn_type      = uint32_t;
+using address_type  = uint8_t;
+using priority_type = uint8_t;
+using size_type     = size_t;
+
+[[maybe_unused]] inline static constexpr address_type global_address = 0xffu;
+[[maybe_unused]] inline static constexpr address_type null_address   = 0xfeu;
+
+// transport protocol, connection management
+[[maybe_unused]] inline static constexpr pgn_type tp_cm_pgn = 0xec00u;
+// transport protocol, data transfer
+[[maybe_unused]] inline static constexpr pgn_type tp_dt_pgn = 0xeb00u;
+
+inline static constexpr size_type max_tp_size          = 1785u;
+inline static constexpr size_type max_fast_packet_size = 223u;
+
+// J1939-21 timeouts: T1 between data packets, T2 waiting data after a CTS.
+inline static constexpr std::chrono::milliseconds t1{750};
+inline static constexpr std::chrono::milliseconds t2{1250};
+
+struct id_fields
+{
+    priority_type _priority    = 0u;
+    pgn_type      _pgn         = 0u;
+    address_type  _source      = 0u;
+    address_type  _destination = global_address;
+};
+
+// Splits a 29-bit identifier. PDU1 PGNs (PF < 240) carry the destination in
+// their low byte, which is cleared from `_pgn`; PDU2 ones are broadcast.
+constexpr auto parse_id(const can::id_type id) -> id_fields
+{
+    const pgn_type pgn  = (id >> 8u) & 0x3ffffu;
+    const bool     pdu1 = ((pgn >> 8u) & 0xffu) < 240u;
+
+    return {
+        static_cast<priority_type>((id >> 26u) & 0x7u),
+        pdu1 ? pgn & 0x3ff00u : pgn,
+        static_cast<address_type>(id & 0xffu),
+        pdu1 ? static_cast<address_type>(pgn & 0xffu) : global_address,
+    };
+}
+
+constexpr auto make_id(const id_fields &f) -> can::id_type
+{
+    const bool     pdu1 = ((f._pgn >> 8u) & 0xffu) < 240u;
+    const pgn_type pgn  = pdu1 ? (f._pgn & 0x3ff00u) | f._destination : f._pgn;
+
+    return (can::id_type{f._priority} & 0x7u) << 26u | (pgn & 0x3ffffu) << 8u | f._source;
+}
+
+// Complete parameter group. `_data` points into the frame or the session
+// buffer, it is only valid during the delivery callback.
+struct packet
+{
+    priority_type            _priority    = 0u;
+    pgn_type                 _pgn         = 0u;
+    address_type             _source      = 0u;
+    address_type             _destination = global_address;
+    std::span<const uint8_t> _data;
+};
+
+// Transport protocol abort reasons (J1939-21).
+enum class abort_reason : uint8_t
+{
+    busy         = 1u,
+    resources    = 2u,
+    timeout      = 3u,
+    bad_sequence = 7u,
+    size_too_big = 9u,
+};
+
+template <size_t Sessions, size_t MaxSize = max_tp_size, size_t CallbackSize = 2u * sizeof(void *)>
+class reassembler
+{
+    static_assert(Sessions > 0u, "reassembler<Sessions>: Sessions must be > 0");
+    static_assert(MaxSize <= max_tp_size, "reassembler<Sessions, MaxSize>: MaxSize must be <= 1785");
+
+    public:
+    using deliver_fn     = function<CallbackSize, void(const packet &)>;
+    using fast_packet_fn = function<CallbackSize, bool(pgn_type)>;
+    using send_fn        = function<CallbackSize, bool(const can::message &)>;
+
+    /// @param deliver Called with every complete parameter group.
+    /// @param is_fast_packet Tells which PGNs use NMEA 2000 fast packet.
+    reassembler(deliver_fn deliver, fast_packet_fn is_fast_packet)
+        : _deliver(std::move(deliver)), _is_fast_packet(std::move(is_fast_packet)), _send(send_nothing)
+    {
+        this->init_free();
+    }
+
+    /// @brief Also answers RTS/CTS transfers addressed to `self`, through `send`.
+    reassembler(deliver_fn deliver, fast_packet_fn is_fast_packet, const address_type self, send_fn send)
+        : _deliver(std::move(deliver)), _is_fast_packet(std::move(is_fast_packet)), _send(std::move(send)),
+          _self(self), _responder(true)
+    {
+        this->init_free();
+    }
+
+    reassembler(const reassembler &)            = delete;
+    reassembler &operator=(const reassembler &) = delete;
+
+    /// @brief Feeds a received frame, `now` being any monotonic time.
+    void on_frame(const can::message &m, const std::chrono::milliseconds now)
+    {
+        if (m._extended)
+        {
+            this->on_frame(parse_id(m._identifier), {m._data.data(), std::min(m._dlc, can::max_dlc)}, now);
+        }
+    }
+
+    /// @brief Feeds a frame as read from a CAN socket, without converting it.
+    /// Remote and error frames are ignored.
+    void on_frame(const can::frame &fr, const std::chrono::milliseconds now)
+    {
+        if (fr.is_extended() && !fr.is_remote() && !fr.is_error())
+        {
+            this->on_frame(parse_id(fr.get_id()), {fr._data.data(), std::min<size_type>(fr._len, can::max_dlc)}, now);
+        }
+    }
+
+    /// @brief Drops the sessions that timed out by `now`.
+    void poll(const std::chrono::milliseconds now)
+    {
+        for (size_type i = 0u; i < Sessions; ++i)
+        {
+            session &s = this->_sessions[i];
+            if (s._active && s._deadline < now)
+            {
+                if (s._respond) { this->send_abort(s, abort_reason::timeout); }
+                this->drop(static_cast<index_type>(i));
+            }
+        }
+    }
+
+    /// @brief Amount of transfers in progress.
+    auto get_active() const -> size_type { return this->_index.size(); }
+
+    /// @brief Amount of transfers abandoned (no free session, timeout,
+    /// sequence error or short frame, abort, or larger than MaxSize).
+    auto get_dropped() const -> size_type { return this->_dropped; }
+
+    private:
+    using index_type = least_index_t<Sessions>;
+
+    // TP.CM control bytes.
+    static constexpr uint8_t CM_RTS   = 16u;
+    static constexpr uint8_t CM_CTS   = 17u;
+    static constexpr uint8_t CM_EOMA  = 19u;
+    static constexpr uint8_t CM_BAM   = 32u;
+    static constexpr uint8_t CM_ABORT = 255u;
+
+    void on_frame(const id_fields &f, const std::span<const uint8_t> data, const std::chrono::milliseconds now)
+    {
+        if (f._pgn == tp_cm_pgn)
+        {
+            this->on_tp_cm(f, data, now);
+        }
+        else if (f._pgn == tp_dt_pgn)
+        {
+            this->on_tp_dt(f, data, now);
+        }
+        else if (this->_is_fast_packet(f._pgn))
+        {
+            this->on_fast_packet(f, data, now);
+        }
+        else
+        {
+            this->_deliver(packet{f._priority, f._pgn, f._source, f._destination, data});
+        }
+    }
+
+    struct session
+    {
+        uint32_t      _key         = 0u;
+        pgn_type      _pgn         = 0u;
+        priority_type _priority    = 0u;
+        address_type  _source      = 0u;
+        address_type  _destination = 0u;
+        bool          _active      = false;
+        //! Connection mode transfer addressed to us, we send CTS/EoMA.
+        bool          _respond     = false;
+        //! Next expected sequence number (TP) or frame counter (fast packet).
+        uint8_t       _next        = 0u;
+        //! Last sequence number allowed by our CTS (TP) or sequence counter
+        //! (fast packet).
+        uint8_t       _limit       = 0u;
+        uint8_t       _packets     = 0u;
+        uint8_t       _per_cts     = 0u;
+        uint16_t      _size        = 0u;
+        uint16_t      _received    = 0u;
+
+        std::chrono::milliseconds    _deadline{};
+        std::array<uint8_t, MaxSize> _data{};
+    };
+
+    static auto send_nothing(const can::message &) -> bool { return false; }
+
+    static constexpr auto tp_key(const address_type source, const address_type destination) -> uint32_t
+    {
+        return uint32_t{source} << 8u | destination;
+    }
+
+    static constexpr auto fast_packet_key(const address_type source, const pgn_type pgn) -> uint32_t
+    {
+        return 1u << 31u | uint32_t{source} << 18u | pgn;
+    }
+
+    static constexpr auto get_pgn(const std::span<const uint8_t> d) -> pgn_type
+    {
+        return pgn_type{d[5]} | pgn_type{d[6]} << 8u | pgn_type{d[7]} << 16u;
+    }
+
+    void init_free()
+    {
+        for (size_type i = 0u; i < Sessions; ++i)
+        {
+            this->_free[i] = static_cast<index_type>(i);
+        }
+        this->_free_count = Sessions;
+    }
+
+    auto find(const uint32_t key) -> session *
+    {
+        const index_type *i = this->_index.find(key);
+        return i != nullptr ? &this->_sessions[*i] : nullptr;
+    }
+
+    /// @brief Starts a session for `key`, replacing the one in progress.
+    /// @return nullptr when every session is in use.
+    auto open(const uint32_t key, const id_fields &f, const pgn_type pgn, const size_type size,
+              const std::chrono::milliseconds deadline) -> session *
+    {
+        if (const index_type *i = this->_index.find(key))
+        {
+            this->drop(*i);
+        }
+
+        if (this->_free_count == 0u)
+        {
+            ++this->_dropped;
+            return nullptr;
+        }
+
+        const index_type i = this->_free[--this->_free_count];
+        this->_index.insert(key, i);
+
+        session &s     = this->_sessions[i];
+        s._key         = key;
+        s._pgn         = pgn;
+        s._priority    = f._priority;
+        s._source      = f._source;
+        s._destination = f._destination;
+        s._active      = true;
+        s._respond     = false;
+        s._size        = static_cast<uint16_t>(size);
+        s._received    = 0u;
+        s._deadline    = deadline;
+
+        return &s;
+    }
+
+    void close(const index_type i)
+    {
+        session &s = this->_sessions[i];
+
+        this->_index.erase(s._key);
+        s._active = false;
+
+        this->_free[this->_free_count++] = i;
+    }
+
+    void drop(const index_type i)
+    {
+        ++this->_dropped;
+        this->close(i);
+    }
+
+    void drop(session &s) { this->drop(static_cast<index_type>(&s - this->_sessions.data())); }
+
+    /// @brief Appends `data` after the bytes received so far, delivers the
+    /// packet once complete. Callers check that the frame lands at
+    /// `_received` first, a short frame must never leave a hole.
+    /// @return true when the session completed.
+    auto append(session &s, const std::span<const uint8_t> data) -> bool
+    {
+        const size_type n = std::min<size_type>(data.size(), s._size - s._received);
+        std::copy_n(data.begin(), n, s._data.begin() + s._received);
+        s._received = static_cast<uint16_t>(s._received + n);
+
+        if (s._received < s._size)
+        {
+            return false;
+        }
+
+        this->_deliver(packet{s._priority, s._pgn, s._source, s._destination, {s._data.data(), s._size}});
+        return true;
+    }
+
+    void on_tp_cm(const id_fields &f, const std::span<const uint8_t> d, const std::chrono::milliseconds now)
+    {
+        if (d.size() < 8u)
+        {
+            return;
+        }
+
+        const pgn_type pgn = get_pgn(d);
+
+        switch (d[0])
+        {
+            case CM_BAM:
+            case CM_RTS:
+            {
+                const size_type size      = size_type{d[1]} | size_type{d[2]} << 8u;
+                const uint8_t   packets   = d[3];
+                const bool      to_us     = d[0] == CM_RTS && this->_responder && f._destination == this->_self;
+                const bool      broadcast = d[0] == CM_BAM;
+
+                if (broadcast != (f._destination == global_address))
+                {
+                    return;
+                }
+
+                if (size < 9u || size > MaxSize || packets != (size + 6u) / 7u)
+                {
+                    ++this->_dropped;
+                    if (to_us && size > MaxSize) { this->send_abort(f, pgn, abort_reason::size_too_big); }
+                    return;
+                }
+
+                session *s = this->open(tp_key(f._source, f._destination), f, pgn, size, now + (to_us ? t2 : t1));
+                if (s == nullptr)
+                {
+                    if (to_us) { this->send_abort(f, pgn, abort_reason::busy); }
+                    return;
+                }
+
+                s->_next    = 1u;
+                s->_packets = packets;
+                s->_respond = to_us;
+                s->_per_cts = d[4] == 0u ? packets : std::min(d[4], packets);
+
+                if (to_us) { this->send_cts(*s); }
+                break;
+            }
+            case CM_ABORT:
+            {
+                // Sent by either end, the session is keyed by its sender.
+                for (const uint32_t key : {tp_key(f._source, f._destination), tp_key(f._destination, f._source)})
+                {
+                    if (session *s = this->find(key); s != nullptr && s->_pgn == pgn)
+                    {
+                        this->drop(*s);
+                    }
+                }
+                break;
+            }
+            case CM_CTS:
+            {
+                // From the receiver of a transfer we follow passively: data
+                // (or, for a hold with 0 packets, another CTS) is due next.
+                session *s = this->find(tp_key(f._destination, f._source));
+                if (s != nullptr && !s->_respond && s->_pgn == pgn)
+                {
+                    s->_deadline = now + t2;
+                }
+                break;
+            }
+            default:
+                // EoMA, nothing to track.
+                break;
+        }
+    }
+
+    void on_tp_dt(const id_fields &f, const std::span<const uint8_t> d, const std::chrono::milliseconds now)
+    {
+        session *s = this->find(tp_key(f._source, f._destination));
+        if (s == nullptr || d.empty())
+        {
+            return;
+        }
+
+        // A short earlier packet shows up as a hole before this one.
+        if (d[0] != s->_next || size_type{d[0] - 1u} * 7u != s->_received)
+        {
+            if (s->_respond) { this->send_abort(*s, abort_reason::bad_sequence); }
+            this->drop(*s);
+            return;
+        }
+
+        if (this->append(*s, d.subspan(1u)))
+        {
+            if (s->_respond) { this->send_eoma(*s); }
+            this->close(static_cast<index_type>(s - this->_sessions.data()));
+            return;
+        }
+
+        ++s->_next;
+        s->_deadline = now + t1;
+
+        if (s->_respond && d[0] == s->_limit)
+        {
+            this->send_cts(*s);
+            s->_deadline = now + t2;
+        }
+    }
+
+    void on_fast_packet(const id_fields &f, const std::span<const uint8_t> d, const std::chrono::milliseconds now)
+    {
+        if (d.size() < 2u)
+        {
+            return;
+        }
+
+        const uint8_t  sequence = d[0] >> 5u;
+        const uint8_t  frame    = d[0] & 0x1fu;
+        const uint32_t key      = fast_packet_key(f._source, f._pgn);
+
+        if (frame == 0u)
+        {
+            const size_type size = d[1];
+            if (size > MaxSize || size > max_fast_packet_size)
+            {
+                ++this->_dropped;
+                return;
+            }
+
+            if (size <= 6u)
+            {
+                if (d.size() < 2u + size)
+                {
+                    ++this->_dropped;
+                    return;
+                }
+
+                this->_deliver(packet{f._priority, f._pgn, f._source, f._destination, d.subspan(2u, size)});
+                return;
+            }
+
+            session *s = this->open(key, f, f._pgn, size, now + t1);
+            if (s != nullptr)
+            {
+                s->_next  = 1u;
+                s->_limit = sequence;
+                this->append(*s, d.subspan(2u));
+            }
+            return;
+        }
+
+        session *s = this->find(key);
+        if (s == nullptr)
+        {
+            return;
+        }
+
+        if (sequence != s->_limit || frame != s->_next || 6u + size_type{frame - 1u} * 7u != s->_received)
+        {
+            this->drop(*s);
+            return;
+        }
+
+        if (this->append(*s, d.subspan(1u)))
+        {
+            this->close(static_cast<index_type>(s - this->_sessions.data()));
+            return;
+        }
+
+        ++s->_next;
+        s->_deadline = now + t1;
+    }
+
+    void send_cm(const address_type to, const std::array<uint8_t, 8> &payload)
+    {
+        const can::id_type id = make_id({7u, tp_cm_pgn, this->_self, to});
+        (void)this->_send(can::message(id, true, payload));
+    }
+
+    /// @brief Asks the sender of `s` for the next window of packets.
+    void send_cts(session &s)
+    {
+        const uint8_t count = std::min<uint8_t>(s._per_cts, static_cast<uint8_t>(s._packets - s._next + 1u));
+        s._limit            = static_cast<uint8_t>(s._next + count - 1u);
+
+        this->send_cm(s._source, {CM_CTS, count, s._next, 0xffu, 0xffu, static_cast<uint8_t>(s._pgn),
+                                  static_cast<uint8_t>(s._pgn >> 8u), static_cast<uint8_t>(s._pgn >> 16u)});
+    }
+
+    void send_eoma(const session &s)
+    {
+        this->send_cm(s._source, {CM_EOMA, static_cast<uint8_t>(s._size), static_cast<uint8_t>(s._size >> 8u),
+                                  s._packets, 0xffu, static_cast<uint8_t>(s._pgn), static_cast<uint8_t>(s._pgn >> 8u),
+                                  static_cast<uint8_t>(s._pgn >> 16u)});
+    }
+
+    void send_abort(const id_fields &f, const pgn_type pgn, const abort_reason reason)
+    {
+        this->send_cm(f._source, {CM_ABORT, static_cast<uint8_t>(reason), 0xffu, 0xffu, 0xffu,
+                                  static_cast<uint8_t>(pgn), static_cast<uint8_t>(pgn >> 8u),
+                                  static_cast<uint8_t>(pgn >> 16u)});
+    }
+
+    void send_abort(const session &s, const abort_reason reason)
+    {
+        this->send_abort(id_fields{s._priority, s._pgn, s._source, s._destination}, s._pgn, reason);
+    }
+
+    deliver_fn     _deliver;
+    fast_packet_fn _is_fast_packet;
+    send_fn        _send;
+
+    address_type _self      = null_address;
+    bool         _responder = false;
+
+    std::array<session, Sessions>                        _sessions{};
+    static_unordered_map<uint32_t, index_type, Sessions> _index;
+
+    //! Stack of the inactive sessions.
+    std::array<index_type, Sessions> _free{};
+    size_type                        _free_count = 0u;
+
+    size_type _dropped = 0u;
+};
+}
+
+#endif
@@ -11,17 +11,26 @@
 #ifndef MTL_QUEUE_H
 #define MTL_QUEUE_H
 
+#include <span>
+#include <memory>
 #include <cstddef>
+#include <utility>
 
 #include "option.h"
 #include "ringbuf.h"
 
 namespace mtl
 {
-template <typename T, size_t LEN> class queue
+/// @brief FIFO queue on top of a ring buffer.
+/// @note With `overflow::overwrite_oldest` enqueueing never fails, the
+/// oldest elements are dropped instead.
+/// @note See `ring_buffer` for when to use `layout::cache_aligned`.
+template <typename T, size_t LEN, overflow Policy = overflow::reject, layout Layout = layout::compact>
+class queue
 {
     public:
-    using storage_type    = ring_buffer<T, LEN>;
+    using storage_type    = ring_buffer<T, LEN, Policy, Layout>;
+    using size_type       = typename storage_type::size_type;
     using reference       = typename storage_type::reference;
     using const_reference = typename storage_type::const_reference;
     
@@ -30,32 +39,69 @@ template <typename T, size_t LEN> class queue
 
     auto enqueue(const_reference data) -> bool
     {
-        if (this->_ringbuffer.get_free() < 1u)
-        {
-            return false;
-        }
-
         return this->_ringbuffer.write(&data, 1u) == 1u;
     };
 
-    auto dequeue(reference data) -> bool
+    auto enqueue(T &&data) -> bool
     {
-        if (this->_ringbuffer.get_occupied() < 1u)
+        return this->emplace(std::move(data));
+    }
+
+    /// @brief Constructs an element directly in the queue storage, in place
+    /// of the (destroyed) free element occupying the slot.
+    template <typename... Args>
+    auto emplace(Args &&...args) -> bool
+    {
+        const auto slot = this->_ringbuffer.reserve(1u);
+        if (slot.empty())
         {
             return false;
         }
 
+        T *elem = &slot._first.front();
+        std::destroy_at(elem);
+        std::construct_at(elem, std::forward<Args>(args)...);
+        return this->_ringbuffer.commit(1u) == 1u;
+    }
+
+    /// @brief Enqueues as many elements of `data` as fit, with a single index update.
+    /// @return Amount of elements enqueued.
+    auto enqueue_bulk(const std::span<const T> data) -> size_type
+    {
+        return this->_ringbuffer.write(data.data(), data.size());
+    }
+
+    auto dequeue(reference data) -> bool
+    {
         return this->_ringbuffer.read(&data, 1u) == 1u;
     }
 
     auto dequeue() -> option<T>
     {
-        if (T val; this->dequeue(val))
+        const auto slot = this->_ringbuffer.peek(1u);
+        if (slot.empty())
         {
-            return move(val);
+            return none;
         }
 
-        return none;
+        option<T> val{std::move(slot._first.front())};
+        this->_ringbuffer.consume(1u);
+
+        return val;
+    }
+
+    /// @brief Dequeues up to `data.size()` elements, with a single index update.
+    /// @return Amount of elements dequeued.
+    auto dequeue_bulk(const std::span<T> data) -> size_type
+    {
+        return this->_ringbuffer.read(data.data(), data.size());
+    }
+
+    /// @brief Amount of elements overwritten before being dequeued.
+    auto get_dropped() const -> size_type
+        requires(Policy == overflow::overwrite_oldest)
+    {
+        return this->_ringbuffer.get_dropped();
     }
     
     private:
@@ -11,45 +11,256 @@
 #ifndef MTL_RINGBUF_H
 #define MTL_RINGBUF_H
 
+#include <bit>
+#include <span>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
 #include <algorithm>
+#include <type_traits>
+
+#include "cache_line.h"
 
 namespace mtl
 {
-template <typename T, size_t SIZE>
+/// @brief What a ring buffer does with new data when it is full.
+enum class overflow : uint8_t
+{
+    reject,           // New data is truncated, what is stored is kept.
+    overwrite_oldest, // New data replaces the oldest stored data.
+};
+
+/// @brief How a ring buffer lays out its members.
+enum class layout : uint8_t
+{
+    compact,       // Smallest footprint.
+    cache_aligned, // Read index, write index and arena on separate cache lines.
+};
+
+namespace detail_ringbuf
+{
+    /// @brief Alignment of each index, a whole cache line when they are
+    /// updated from different cores.
+    template <layout Layout>
+    inline constexpr size_t index_alignment = Layout == layout::cache_aligned ? cache_line_size : alignof(size_t);
+
+    /// @brief Read/write positions of a ring buffer with any SIZE.
+    ///
+    /// Positions are kept within [0, SIZE), a full buffer is told apart from an
+    /// empty one by the `_wrap` flag.
+    template <size_t SIZE, layout Layout, bool = std::has_single_bit(SIZE)>
+    class indices
+    {
+        public:
+        constexpr auto occupied() const -> size_t
+        {
+            if (this->_end == this->_begin)
+            {
+                return this->_wrap ? SIZE : 0u;
+            }
+
+            if (this->_end > this->_begin)
+            {
+                return this->_end - this->_begin;
+            }
+
+            return SIZE + this->_end - this->_begin;
+        }
+
+        constexpr auto begin_pos() const -> size_t { return this->_begin; }
+        constexpr auto end_pos() const -> size_t { return this->_end; }
+
+        /// @note `n` must be in (0, occupied()].
+        constexpr void advance_begin(const size_t n)
+        {
+            this->_begin = wrap(this->_begin + n);
+            this->_wrap  = false;
+        }
+
+        /// @note `n` must be in (0, SIZE - occupied()].
+        constexpr void advance_end(const size_t n)
+        {
+            this->_end = wrap(this->_end + n);
+
+            if (this->_begin == this->_end)
+            {
+                this->_wrap = true;
+            }
+        }
+
+        /// @brief Advances the end by `n` in (0, SIZE], dragging the begin
+        /// along past any overwritten element.
+        /// @return Amount of overwritten elements.
+        constexpr auto advance_end_overwrite(const size_t n) -> size_t
+        {
+            const size_t over = n - std::min(n, SIZE - this->occupied());
+
+            this->_end = wrap(this->_end + n);
+            if (over != 0u)
+            {
+                this->_begin = this->_end;
+            }
+
+            if (this->_begin == this->_end)
+            {
+                this->_wrap = true;
+            }
+
+            return over;
+        }
+
+        private:
+        // Both operands are below SIZE, a single subtraction replaces `% SIZE`.
+        static constexpr auto wrap(const size_t i) -> size_t { return i >= SIZE ? i - SIZE : i; }
+
+        alignas(index_alignment<Layout>) size_t _begin = 0;
+        alignas(index_alignment<Layout>) size_t _end   = 0;
+        // Written by both sides, kept next to `_end` as writes are usually hotter.
+        bool _wrap = false;
+    };
+
+    /// @brief Read/write positions of a ring buffer with a power of two SIZE.
+    ///
+    /// Indices run freely and are masked on access. Since SIZE divides the
+    /// index range, `_end - _begin` stays correct across overflow and no wrap
+    /// flag is needed.
+    template <size_t SIZE, layout Layout>
+    class indices<SIZE, Layout, true>
+    {
+        public:
+        constexpr auto occupied() const -> size_t { return this->_end - this->_begin; }
+
+        constexpr auto begin_pos() const -> size_t { return this->_begin & MASK; }
+        constexpr auto end_pos() const -> size_t { return this->_end & MASK; }
+
+        constexpr void advance_begin(const size_t n) { this->_begin += n; }
+        constexpr void advance_end(const size_t n) { this->_end += n; }
+
+        constexpr auto advance_end_overwrite(const size_t n) -> size_t
+        {
+            const size_t over = n - std::min(n, SIZE - this->occupied());
+
+            this->_end += n;
+            this->_begin += over;
+
+            return over;
+        }
+
+        private:
+        static constexpr size_t MASK = SIZE - 1u;
+
+        alignas(index_alignment<Layout>) size_t _begin = 0;
+        alignas(index_alignment<Layout>) size_t _end   = 0;
+    };
+
+    /// @brief Copies `n` elements, as a single memcpy when `T` allows it.
+    template <typename T>
+    inline void copy_elements(const T *src, const size_t n, T *dest)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(dest, src, n * sizeof(T));
+        }
+        else
+        {
+            std::copy_n(src, n, dest);
+        }
+    }
+
+    /// @brief Moves `n` elements, as a single memcpy when `T` allows it.
+    template <typename T>
+    inline void move_elements(T *src, const size_t n, T *dest)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(dest, src, n * sizeof(T));
+        }
+        else
+        {
+            std::move(src, src + n, dest);
+        }
+    }
+
+    /// @brief Stand-in for counters that a configuration does not need.
+    struct no_counter {};
+}
+
+/// @brief Up to two contiguous regions of a ring buffer, in FIFO order.
+/// @note `_second` is only non-empty when the region wraps around the arena end.
+template <typename T>
+struct ring_buffer_regions
+{
+    std::span<T> _first;
+    std::span<T> _second;
+
+    constexpr auto size() const -> size_t { return this->_first.size() + this->_second.size(); }
+    constexpr auto empty() const -> bool { return this->size() == 0u; }
+};
+
+/// @brief Statically allocated ring buffer.
+/// @note When SIZE is a power of two, index arithmetic is done with masks
+/// instead of modulo and branches, prefer those sizes on hot paths.
+///
+/// With `overflow::overwrite_oldest`, writes never fail: when there is not
+/// enough room the oldest elements are discarded and counted by
+/// `get_dropped()`, e.g. for a black-box history of the last N samples.
+///
+/// With `layout::cache_aligned`, the read index, the write index and the
+/// arena each start a cache line and the object size is a multiple of it.
+/// Use it when producer and consumer run on different cores, or when several
+/// buffers shared between cores are placed next to each other.
+template <typename T, size_t SIZE, overflow Policy = overflow::reject, layout Layout = layout::compact>
 class ring_buffer
 {
+    static constexpr bool OVERWRITE = Policy == overflow::overwrite_oldest;
+
     public:
     using size_type        = size_t;
     using reference        = T&;
     using const_reference  = const T&;
     using iterator         = T*;
     using const_iterator   = const T*;
+    using regions          = ring_buffer_regions<T>;
+    using const_regions    = ring_buffer_regions<const T>;
     
+    /// @return Amount of elements taken from `data`. In overwrite mode that
+    /// is always `n`, even when older ones among them got overwritten.
     auto write(const_iterator data, size_type n) -> size_type
     {
-        n = std::min(n, this->get_free());
+        const size_type requested = n;
+
+        if constexpr (OVERWRITE)
+        {
+            // Only the newest SIZE elements of `data` could survive anyway.
+            if (n > SIZE)
+            {
+                this->_dropped += n - SIZE;
+                data += n - SIZE;
+                n = SIZE;
+            }
+        }
+        else
+        {
+            n = std::min(n, this->get_free());
+        }
+
         if (n == 0) { return n; }
 
-        const size_type first_chunk = std::min(n, SIZE - this->_end);
+        const size_type end         = this->_idx.end_pos();
+        const size_type first_chunk = std::min(n, SIZE - end);
         
-        std::copy_n(data, first_chunk * sizeof(T), this->_arena + this->_end);
-        this->_end = (this->_end + first_chunk) % SIZE;
+        detail_ringbuf::copy_elements(data, first_chunk, this->_arena + end);
 
         if (first_chunk < n)
         {
             const size_type second_chunk = n - first_chunk;
 
-            std::copy_n(data + first_chunk, second_chunk * sizeof(T), this->_arena + this->_end);
-            this->_end = (this->_end + second_chunk) % SIZE;
+            detail_ringbuf::copy_elements(data + first_chunk, second_chunk, this->_arena);
         }
 
-        if (this->_begin == this->_end)
-        {
-            this->_wrap = true;
-        }
-
-        return n;
+        this->advance_end(n);
+        return OVERWRITE ? requested : n;
     }
 
     auto read(iterator dest, size_type n) -> size_type
@@ -57,49 +268,108 @@ class ring_buffer
         n = std::min(n, get_occupied());
         if (n == 0) { return n; }
 
-        if (this->_wrap)
-        {
-            this->_wrap = false;
-        }
-
-        const size_type first_chunk = std::min(n, SIZE - this->_begin);
+        const size_type begin       = this->_idx.begin_pos();
+        const size_type first_chunk = std::min(n, SIZE - begin);
         
-        std::copy_n(this->_arena + this->_begin, first_chunk * sizeof(T), dest);
-        this->_begin = (this->_begin + first_chunk) % SIZE;
+        detail_ringbuf::move_elements(this->_arena + begin, first_chunk, dest);
 
         if (first_chunk < n)
         {
             const size_type second_chunk = n - first_chunk;
-            std::copy_n(this->_arena + this->_begin, second_chunk * sizeof(T), dest + first_chunk);
-
-            this->_begin = (this->_begin + second_chunk) % SIZE;
+            detail_ringbuf::move_elements(this->_arena, second_chunk, dest + first_chunk);
         }
+
+        this->_idx.advance_begin(n);
         return n;
     }
 
-    auto get_occupied() const -> size_type
+    /// @brief Exposes up to `n` free elements for the caller to fill in place
+    /// (e.g. as a DMA target). Nothing is published until `commit()`.
+    /// @note In overwrite mode the regions may cover the oldest elements,
+    /// which are only discarded on `commit()`.
+    auto reserve(size_type n) -> regions
     {
-        if (this->_end == this->_begin)
-        {
-            return this->_wrap ? SIZE : 0u;
-        }
+        n = std::min(n, this->get_writable());
+        return this->regions_at<T>(this->_arena, this->_idx.end_pos(), n);
+    }
 
-        if (this->_end > this->_begin)
-        {
-            return this->_end - this->_begin;
-        }
+    /// @brief Publishes the first `n` elements of the last `reserve()`.
+    /// @return Amount of elements committed, clamped to the reservable space.
+    auto commit(size_type n) -> size_type
+    {
+        n = std::min(n, this->get_writable());
+        if (n != 0) { this->advance_end(n); }
 
-        return SIZE + this->_end - this->_begin;
+        return n;
     }
 
+    /// @brief Exposes up to `n` of the oldest elements without removing them.
+    auto peek(size_type n = SIZE) const -> const_regions
+    {
+        n = std::min(n, this->get_occupied());
+        return this->regions_at<const T>(this->_arena, this->_idx.begin_pos(), n);
+    }
+
+    /// @brief Mutable `peek()`, allows moving elements out before `consume()`.
+    auto peek(size_type n = SIZE) -> regions
+    {
+        n = std::min(n, this->get_occupied());
+        return this->regions_at<T>(this->_arena, this->_idx.begin_pos(), n);
+    }
+
+    /// @brief Removes the `n` oldest elements, usually after a `peek()`.
+    /// @return Amount of elements removed, clamped to the occupied space.
+    auto consume(size_type n) -> size_type
+    {
+        n = std::min(n, this->get_occupied());
+        if (n != 0) { this->_idx.advance_begin(n); }
+
+        return n;
+    }
+
+    auto get_occupied() const -> size_type { return this->_idx.occupied(); }
+
     auto get_free() const -> size_type { return SIZE - this->get_occupied(); }
+
+    /// @brief Amount of elements overwritten before being read.
+    auto get_dropped() const -> size_type
+        requires OVERWRITE
+    {
+        return this->_dropped;
+    }
     
     private:
-    T _arena[SIZE]{};
+    auto get_writable() const -> size_type { return OVERWRITE ? SIZE : this->get_free(); }
+
+    void advance_end(const size_type n)
+    {
+        if constexpr (OVERWRITE)
+        {
+            this->_dropped += this->_idx.advance_end_overwrite(n);
+        }
+        else
+        {
+            this->_idx.advance_end(n);
+        }
+    }
+
+    /// @brief Splits `n` elements starting at `pos` into the part before the
+    /// arena end and the part wrapped to its start.
+    template <typename U>
+    static auto regions_at(U *arena, const size_type pos, const size_type n) -> ring_buffer_regions<U>
+    {
+        const size_type first_chunk = std::min(n, SIZE - pos);
+        return {{arena + pos, first_chunk}, {arena, n - first_chunk}};
+    }
+
+    static constexpr size_t ARENA_ALIGNMENT =
+        Layout == layout::cache_aligned ? std::max(cache_line_size, alignof(T)) : alignof(T);
+
+    alignas(ARENA_ALIGNMENT) T _arena[SIZE]{};
+
+    detail_ringbuf::indices<SIZE, Layout> _idx;
 
-    size_type _begin = 0;
-    size_type _end   = 0;
-    bool   _wrap     = false;
+    [[no_unique_address]] std::conditional_t<OVERWRITE, size_type, detail_ringbuf::no_counter> _dropped{};
 };
 }
 
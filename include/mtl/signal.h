@@ -0,0 +1,220 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file signal.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Statically allocated signals (observer lists).
+///
+/// `signal<N, void(Args...)>` calls every connected handler on `emit()`.
+/// Handlers are `mtl::function<Size, void(Args...)>` kept in a slot map, so
+/// connecting returns a handle that disconnects exactly that handler later.
+///
+/// `filtered_signal<N, Key, void(Args...)>` connects handlers to a key and
+/// `emit(key, ...)` only calls the handlers of that key, found through a
+/// hash map instead of asking every subscriber. e.g. dispatching CAN frames
+/// by identifier:
+///
+/// @code
+/// mtl::filtered_signal<64, uint32_t, void(const can::message &)> rx;
+///
+/// rx.connect(0x18fef100u, [&](const can::message &m) { ... });
+/// rx.emit(frame._identifier, frame);
+/// @endcode
+///
+/// Handlers must not connect or disconnect handlers of the signal emitting
+/// them.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_SIGNAL_H
+#define MTL_SIGNAL_H
+
+#include <span>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include "hash.h"
+#include "option.h"
+#include "function.h"
+#include "slot_map.h"
+#include "unordered_map.h"
+
+namespace mtl
+{
+template <size_t N, typename Signature, size_t Size = 2u * sizeof(void *)>
+class signal;
+
+template <size_t N, typename... Args, size_t Size>
+class signal<N, void(Args...), Size>
+{
+    public:
+    using size_type     = size_t;
+    using function_type = function<Size, void(Args...)>;
+    using handle        = typename slot_map<function_type, N>::handle;
+
+    /// @return Handle of the new connection, none when N handlers are connected.
+    template <typename F>
+    auto connect(F &&fn) -> option<handle>
+    {
+        return this->_handlers.emplace(std::forward<F>(fn));
+    }
+
+    /// @return false when `h` was already disconnected.
+    auto disconnect(const handle h) -> bool { return this->_handlers.erase(h); }
+
+    auto is_connected(const handle h) const -> bool { return this->_handlers.contains(h); }
+
+    /// @brief Calls every handler, in no particular order.
+    void emit(Args... args)
+    {
+        for (function_type &fn : this->_handlers)
+        {
+            fn(args...);
+        }
+    }
+
+    /// @brief Emits once per element of `events`, handler by handler, so
+    /// each handler runs over the whole batch while it is hot in cache.
+    template <typename E>
+        requires(sizeof...(Args) == 1u && (std::is_invocable_v<function_type &, const E &>))
+    void emit_bulk(const std::span<const E> events)
+    {
+        for (function_type &fn : this->_handlers)
+        {
+            for (const E &e : events)
+            {
+                fn(e);
+            }
+        }
+    }
+
+    auto size() const -> size_type { return this->_handlers.size(); }
+    auto empty() const -> bool { return this->_handlers.empty(); }
+    auto full() const -> bool { return this->_handlers.full(); }
+    static constexpr auto capacity() -> size_type { return N; }
+
+    private:
+    slot_map<function_type, N> _handlers;
+};
+
+template <size_t N, typename Key, typename Signature, size_t Size = 2u * sizeof(void *), typename Hash = mtl::hash<Key>>
+class filtered_signal;
+
+template <size_t N, typename Key, typename... Args, size_t Size, typename Hash>
+class filtered_signal<N, Key, void(Args...), Size, Hash>
+{
+    public:
+    using size_type     = size_t;
+    using key_type      = Key;
+    using function_type = function<Size, void(Args...)>;
+
+    private:
+    struct entry
+    {
+        Key           _key{};
+        function_type _fn;
+    };
+
+    public:
+    using handle = typename slot_map<entry, N>::handle;
+
+    /// @brief Connects `fn` to the emissions of `key`, after the handlers
+    /// already connected to it.
+    /// @return Handle of the new connection, none when N handlers are connected.
+    template <typename F>
+    auto connect(const Key &key, F &&fn) -> option<handle>
+    {
+        option<handle> h = this->_entries.emplace(key, function_type(std::forward<F>(fn)));
+        if (!h)
+        {
+            return none;
+        }
+
+        this->_next[h->_index] = handle{};
+
+        handle *head = this->_heads.find(key);
+        if (head == nullptr)
+        {
+            // A free handler slot means a free key slot too, both hold N.
+            this->_heads.insert(key, *h);
+            return h;
+        }
+
+        handle last = *head;
+        while (this->_entries.contains(this->_next[last._index]))
+        {
+            last = this->_next[last._index];
+        }
+        this->_next[last._index] = *h;
+
+        return h;
+    }
+
+    /// @return false when `h` was already disconnected.
+    auto disconnect(const handle h) -> bool
+    {
+        const entry *e = this->_entries.get(h);
+        if (e == nullptr)
+        {
+            return false;
+        }
+
+        const handle next = this->_next[h._index];
+        handle      *head = this->_heads.find(e->_key);
+
+        if (*head == h)
+        {
+            if (this->_entries.contains(next)) { *head = next; }
+            else { this->_heads.erase(e->_key); }
+        }
+        else
+        {
+            handle prev = *head;
+            while (this->_next[prev._index] != h)
+            {
+                prev = this->_next[prev._index];
+            }
+            this->_next[prev._index] = next;
+        }
+
+        return this->_entries.erase(h);
+    }
+
+    auto is_connected(const handle h) const -> bool { return this->_entries.contains(h); }
+
+    /// @brief Calls the handlers connected to `key`, in connection order.
+    void emit(const Key &key, Args... args)
+    {
+        const handle *head = this->_heads.find(key);
+        if (head == nullptr)
+        {
+            return;
+        }
+
+        for (handle h = *head; entry *e = this->_entries.get(h); h = this->_next[h._index])
+        {
+            e->_fn(args...);
+        }
+    }
+
+    auto size() const -> size_type { return this->_entries.size(); }
+    auto empty() const -> bool { return this->_entries.empty(); }
+    auto full() const -> bool { return this->_entries.full(); }
+    static constexpr auto capacity() -> size_type { return N; }
+
+    private:
+    slot_map<entry, N> _entries;
+    //! Next handler of the same key, indexed by slot. Chains end with a
+    //! handle that is not connected.
+    std::array<handle, N> _next{};
+    //! First handler of every key with handlers.
+    static_unordered_map<Key, handle, N, Hash> _heads;
+};
+}
+
+#endif
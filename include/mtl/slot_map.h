@@ -0,0 +1,181 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file slot_map.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Statically allocated slot map.
+///
+/// Stores values in a dense array, for cache friendly iteration, and hands
+/// out stable handles to them. A handle goes through a sparse slot table
+/// holding the value's dense position and a generation counter, so insert,
+/// erase and lookup are O(1) and a handle to an erased value is detected
+/// instead of silently reaching whatever reused its slot.
+///
+/// Erasing moves the last dense value into the hole, so dense positions
+/// (and pointers to values) change, handles don't.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_SLOT_MAP_H
+#define MTL_SLOT_MAP_H
+
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include "option.h"
+#include "type_traits.h"
+
+namespace mtl
+{
+template <typename T, size_t N>
+class slot_map
+{
+    static_assert(N > 0u, "slot_map<T, N>: N must be > 0");
+
+    public:
+    using size_type       = size_t;
+    using index_type      = least_index_t<N>;
+    using generation_type = uint32_t;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    /// @brief Stable reference to a value. Default constructed handles are
+    /// never valid.
+    struct handle
+    {
+        index_type      _index      = 0u;
+        generation_type _generation = 0u;
+
+        constexpr friend auto operator==(const handle &, const handle &) -> bool = default;
+    };
+
+    constexpr slot_map() noexcept
+    {
+        for (size_t i = 0u; i < N; ++i)
+        {
+            this->_slots[i]._link = static_cast<index_type>(i + 1u);
+        }
+    }
+
+    /// @return The new value's handle, none when the map is full.
+    template <typename... Args>
+    constexpr auto emplace(Args &&...args) -> option<handle>
+    {
+        const index_type index = this->_free;
+        if (index == NIL)
+        {
+            return none;
+        }
+
+        slot &s     = this->_slots[index];
+        this->_free = s._link;
+
+        this->_values[this->_size]        = T(std::forward<Args>(args)...);
+        this->_dense_to_slot[this->_size] = index;
+
+        s._link = static_cast<index_type>(this->_size++);
+        ++s._generation;
+
+        return handle{index, s._generation};
+    }
+
+    constexpr auto insert(const T &value) -> option<handle> { return this->emplace(value); }
+    constexpr auto insert(T &&value) -> option<handle> { return this->emplace(std::move(value)); }
+
+    /// @return false when `h` does not refer to a value (anymore).
+    constexpr auto erase(const handle h) -> bool
+    {
+        if (!this->contains(h))
+        {
+            return false;
+        }
+
+        slot &s = this->_slots[h._index];
+
+        // Fill the hole with the last dense value.
+        const index_type hole = s._link;
+        const index_type last = static_cast<index_type>(--this->_size);
+
+        if (hole != last)
+        {
+            this->_values[hole]        = std::move(this->_values[last]);
+            this->_dense_to_slot[hole] = this->_dense_to_slot[last];
+
+            this->_slots[this->_dense_to_slot[hole]]._link = hole;
+        }
+
+        // Release whatever the value holds, the slot is not destroyed.
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            this->_values[last] = T{};
+        }
+
+        ++s._generation;
+        s._link     = this->_free;
+        this->_free = h._index;
+
+        return true;
+    }
+
+    constexpr auto contains(const handle h) const -> bool
+    {
+        return h._index < N && this->_slots[h._index]._generation == h._generation && is_live(h._generation);
+    }
+
+    /// @return The value referred to by `h`, nullptr when it was erased.
+    constexpr auto get(const handle h) -> T * { return this->contains(h) ? &this->_values[this->_slots[h._index]._link] : nullptr; }
+    constexpr auto get(const handle h) const -> const T * { return this->contains(h) ? &this->_values[this->_slots[h._index]._link] : nullptr; }
+
+    /// @brief Handle of the value at dense position `i` (e.g. while iterating).
+    constexpr auto get_handle(const size_type i) const -> handle
+    {
+        const index_type index = this->_dense_to_slot[i];
+        return handle{index, this->_slots[index]._generation};
+    }
+
+    constexpr auto size() const -> size_type { return this->_size; }
+    constexpr auto empty() const -> bool { return this->_size == 0u; }
+    constexpr auto full() const -> bool { return this->_size == N; }
+    static constexpr auto capacity() -> size_type { return N; }
+
+    /// @brief Dense iteration over values, in no particular order.
+    constexpr auto begin() -> iterator { return this->_values.data(); }
+    constexpr auto end() -> iterator { return this->_values.data() + this->_size; }
+    constexpr auto begin() const -> const_iterator { return this->_values.data(); }
+    constexpr auto end() const -> const_iterator { return this->_values.data() + this->_size; }
+
+    constexpr auto values() -> std::span<T> { return {this->_values.data(), this->_size}; }
+    constexpr auto values() const -> std::span<const T> { return {this->_values.data(), this->_size}; }
+
+    private:
+    static constexpr index_type NIL = static_cast<index_type>(N);
+
+    // Generations are bumped on insert and on erase, so an odd one means the
+    // slot is in use and a stale handle never matches the current one.
+    static constexpr auto is_live(const generation_type g) -> bool { return (g & 1u) != 0u; }
+
+    struct slot
+    {
+        //! Dense position when live, next free slot otherwise.
+        index_type      _link       = 0u;
+        generation_type _generation = 0u;
+    };
+
+    std::array<T, N>          _values{};
+    std::array<index_type, N> _dense_to_slot{};
+    std::array<slot, N>       _slots{};
+
+    //! First free slot, NIL when full.
+    index_type _free = 0u;
+    size_type  _size = 0u;
+};
+}
+
+#endif
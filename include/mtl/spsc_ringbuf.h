@@ -0,0 +1,122 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file spsc_ringbuf.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Lock-free single-producer/single-consumer ring buffer.
+///
+/// One context (e.g. an ISR) may call `write()` while another one calls
+/// `read()` without any lock. The producer only stores `_end` and the
+/// consumer only stores `_begin`; each side publishes with release and
+/// observes the other side with acquire.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_SPSC_RINGBUF_H
+#define MTL_SPSC_RINGBUF_H
+
+#include <bit>
+#include <atomic>
+#include <cstddef>
+#include <algorithm>
+
+#include "cache_line.h"
+
+namespace mtl
+{
+template <typename T, size_t SIZE>
+class spsc_ring_buffer
+{
+    static_assert(std::has_single_bit(SIZE),
+                  "spsc_ring_buffer<T, SIZE>: SIZE must be a power of two");
+
+    public:
+    using size_type        = size_t;
+    using reference        = T&;
+    using const_reference  = const T&;
+    using iterator         = T*;
+    using const_iterator   = const T*;
+
+    /// @brief Producer side. Copies up to `n` elements, returns how many fit.
+    auto write(const_iterator data, size_type n) -> size_type
+    {
+        const size_type end = this->_end.load(std::memory_order_relaxed);
+
+        // Only reload the consumer index when the cached one says we're full,
+        // this keeps the consumer's line out of the producer's cache.
+        if (SIZE - (end - this->_producer_begin) < n)
+        {
+            this->_producer_begin = this->_begin.load(std::memory_order_acquire);
+        }
+
+        n = std::min(n, SIZE - (end - this->_producer_begin));
+        if (n == 0) { return n; }
+
+        const size_type pos         = end & MASK;
+        const size_type first_chunk = std::min(n, SIZE - pos);
+
+        std::copy_n(data, first_chunk, this->_arena + pos);
+        std::copy_n(data + first_chunk, n - first_chunk, this->_arena);
+
+        this->_end.store(end + n, std::memory_order_release);
+        return n;
+    }
+
+    /// @brief Consumer side. Copies up to `n` elements, returns how many were read.
+    auto read(iterator dest, size_type n) -> size_type
+    {
+        const size_type begin = this->_begin.load(std::memory_order_relaxed);
+
+        if (this->_consumer_end - begin < n)
+        {
+            this->_consumer_end = this->_end.load(std::memory_order_acquire);
+        }
+
+        n = std::min(n, this->_consumer_end - begin);
+        if (n == 0) { return n; }
+
+        const size_type pos         = begin & MASK;
+        const size_type first_chunk = std::min(n, SIZE - pos);
+
+        std::copy_n(this->_arena + pos, first_chunk, dest);
+        std::copy_n(this->_arena, n - first_chunk, dest + first_chunk);
+
+        this->_begin.store(begin + n, std::memory_order_release);
+        return n;
+    }
+
+    /// @note Only exact when called from the producer or consumer context,
+    /// from a third context it is a snapshot.
+    auto get_occupied() const -> size_type
+    {
+        const size_type begin = this->_begin.load(std::memory_order_acquire);
+        const size_type end   = this->_end.load(std::memory_order_acquire);
+        return end - begin;
+    }
+
+    auto get_free() const -> size_type { return SIZE - this->get_occupied(); }
+
+    private:
+    static constexpr size_type MASK = SIZE - 1u;
+
+    // Indices run freely and wrap at the size_type limit, masking keeps the
+    // arena position valid since SIZE divides the index range.
+
+    //! Consumer owned.
+    alignas(cache_line_size) std::atomic<size_type> _begin{0};
+    //! Consumer's last known value of `_end`.
+    size_type _consumer_end = 0;
+
+    //! Producer owned.
+    alignas(cache_line_size) std::atomic<size_type> _end{0};
+    //! Producer's last known value of `_begin`.
+    size_type _producer_begin = 0;
+
+    alignas(cache_line_size) T _arena[SIZE]{};
+};
+}
+
+#endif
@@ -15,7 +15,9 @@
 
 #include <array>
 #include <utility>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <type_traits>
 
 namespace mtl
@@ -132,6 +134,31 @@ template <typename T, size_t N> class static_list
         this->_free = elem;
     }
 
+    /// @brief Unlink the nodes [head, tail] from the list, keeping their inner links.
+    constexpr void link_range_out(static_list_node<T> *head, static_list_node<T> *tail)
+    {
+        if (head->prev) { head->prev->next = tail->next; }
+        else            { this->_first = tail->next; }
+
+        if (tail->next) { tail->next->prev = head->prev; }
+        else            { this->_last = head->prev; }
+    }
+
+    /// @brief Link the detached nodes [head, tail] before `pos` (nullptr: at the end).
+    constexpr void link_range_before(static_list_node<T> *pos, static_list_node<T> *head, static_list_node<T> *tail)
+    {
+        auto *prev = pos ? pos->prev : this->_last;
+
+        head->prev = prev;
+        tail->next = pos;
+
+        if (prev) { prev->next = head; }
+        else      { this->_first = head; }
+
+        if (pos) { pos->prev = tail; }
+        else     { this->_last = tail; }
+    }
+
     /// @brief Directly Access the array elements that store the nodes.
     constexpr static_list_node<T> *get_array_entry(size_t i)
     {
@@ -246,8 +273,8 @@ template <typename T, size_t N> class static_list
             }
             else
             {
-                auto *i_prev = i.v_->prev;
-                auto *next   = i.v_;
+                auto *i_prev = i._v->prev;
+                auto *next   = i._v;
                 elem->prev   = i_prev;
                 if (i_prev)
                 {
@@ -300,12 +327,12 @@ template <typename T, size_t N> class static_list
     }
 
     constexpr void push_back(const T &value) { this->emplace_back(value); }
-    constexpr void push_back(T &&value) { this->emplace_back(move(value)); }
+    constexpr void push_back(T &&value) { this->emplace_back(std::move(value)); }
 
     /// @brief Erase at iterator position.
     constexpr void erase(iterator i)
     {
-        auto org_ptr = i.v_;
+        auto org_ptr = i._v;
         // Remove from list
         auto org_next = org_ptr->next;
         auto org_prev = org_ptr->prev;
@@ -333,6 +360,193 @@ template <typename T, size_t N> class static_list
         this->return_free_elem(org_ptr);
     }
 
+    /// @brief Move the elements of `other` before `pos`, in order.
+    ///
+    /// Nodes belong to the buffer of the list that owns them, so across lists
+    /// the values are moved into free nodes of this list (no allocation, but
+    /// one move per element). Stops when this list is full.
+    ///
+    /// @return Amount of elements moved.
+    constexpr size_t splice(iterator pos, static_list &other)
+    {
+        return this->splice(pos, other, other.begin(), other.end());
+    }
+
+    /// @brief Move the element at `it` of `other` before `pos`.
+    /// @return Amount of elements moved (0 when this list is full).
+    constexpr size_t splice(iterator pos, static_list &other, iterator it)
+    {
+        auto next = it;
+        return this->splice(pos, other, it, ++next);
+    }
+
+    /// @brief Move the elements in [first, last) of `other` before `pos`.
+    ///
+    /// Within the same list this only relinks nodes, `pos` must not be in
+    /// [first, last).
+    ///
+    /// @return Amount of elements moved.
+    constexpr size_t splice(iterator pos, static_list &other, iterator first, iterator last)
+    {
+        size_t count = 0u;
+
+        if (&other == this)
+        {
+            if (first == last || pos == last)
+            {
+                return count;
+            }
+
+            // Detach [first, last).
+            auto *head = first._v;
+            auto *tail = head;
+            for (++count; tail->next != last._v; ++count)
+            {
+                tail = tail->next;
+            }
+
+            this->link_range_out(head, tail);
+            this->link_range_before(pos._v, head, tail);
+
+            return count;
+        }
+
+        for (auto *n = first._v; n != last._v && this->_free != nullptr; ++count)
+        {
+            auto *next = n->next;
+
+            this->emplace(pos, std::move(n->value));
+            other.erase(iterator(n));
+
+            n = next;
+        }
+
+        return count;
+    }
+
+    /// @brief Merge the sorted list `other` into this sorted list.
+    ///
+    /// Stable: on equal elements those of this list come first. Elements of
+    /// `other` are moved as in `splice()`, what does not fit stays in `other`.
+    template <typename Compare = std::less<T>>
+    constexpr void merge(static_list &other, Compare cmp = Compare{})
+    {
+        if (&other == this)
+        {
+            return;
+        }
+
+        auto *pos = this->_first;
+        while (other._first != nullptr && this->_free != nullptr)
+        {
+            while (pos != nullptr && !cmp(other._first->value, pos->value))
+            {
+                pos = pos->next;
+            }
+
+            this->splice(iterator(pos), other, other.begin());
+        }
+    }
+
+    /// @brief Sort the list by relinking nodes, no value is moved.
+    ///
+    /// Stable bottom-up merge sort: O(n log n) compares, O(1) memory.
+    template <typename Compare = std::less<T>>
+    constexpr void sort(Compare cmp = Compare{})
+    {
+        static_list_node<T> *list = this->_first;
+        if (list == nullptr)
+        {
+            return;
+        }
+
+        // Merge runs of `width` nodes pairwise until a single run is left.
+        for (size_t width = 1u;; width *= 2u)
+        {
+            static_list_node<T> *p    = list;
+            static_list_node<T> *tail = nullptr;
+            size_t               runs = 0u;
+
+            list = nullptr;
+
+            while (p != nullptr)
+            {
+                ++runs;
+
+                static_list_node<T> *q = p;
+                size_t p_size = 0u;
+                for (; p_size < width && q != nullptr; ++p_size)
+                {
+                    q = q->next;
+                }
+
+                size_t q_size = width;
+                while (p_size > 0u || (q_size > 0u && q != nullptr))
+                {
+                    static_list_node<T> *e = nullptr;
+
+                    // Only take from the right run when strictly smaller, for stability.
+                    if (p_size == 0u || (q_size > 0u && q != nullptr && cmp(q->value, p->value)))
+                    {
+                        e = q;
+                        q = q->next;
+                        --q_size;
+                    }
+                    else
+                    {
+                        e = p;
+                        p = p->next;
+                        --p_size;
+                    }
+
+                    if (tail != nullptr)
+                    {
+                        tail->next = e;
+                    }
+                    else
+                    {
+                        list = e;
+                    }
+
+                    e->prev = tail;
+                    tail    = e;
+                }
+
+                p = q;
+            }
+
+            tail->next = nullptr;
+
+            if (runs <= 1u)
+            {
+                this->_first = list;
+                this->_last  = tail;
+                return;
+            }
+        }
+    }
+
+    /// @brief Erase every element for which `pred` returns true.
+    /// @return Amount of elements erased.
+    template <typename Pred> constexpr size_t remove_if(Pred pred)
+    {
+        size_t count = 0u;
+
+        for (auto *n = this->_first; n != nullptr;)
+        {
+            auto *next = n->next;
+            if (pred(n->value))
+            {
+                this->erase(iterator(n));
+                ++count;
+            }
+
+            n = next;
+        }
+
+        return count;
+    }
+
     /// @brief Construct a new list.
     constexpr static_list() noexcept
     {
@@ -26,10 +26,15 @@ namespace detail_string_view
         using const_pointer = const CharT*;
         using size_type     = size_t;
 
+        constexpr basic_string_view() : _p(nullptr), _sz(0) {}
+
         template <size_type N>
         constexpr basic_string_view(CharT (&a)[N])
             : _p(a), _sz(N - 1) {}
 
+        constexpr basic_string_view(pointer p, const size_type n)
+            : _p(p), _sz(n) {}
+
         constexpr auto operator[](const size_type n) const -> char_type
         {
             return n < _sz ? _p[n] : CharT{};
@@ -43,6 +48,26 @@ namespace detail_string_view
         constexpr auto begin() const -> pointer { return this->_p; }
         constexpr auto end() const -> pointer { return this->_p + this->_sz; }
 
+        constexpr auto data() const -> pointer { return this->_p; }
+
+        constexpr friend auto operator==(const basic_string_view &lhs, const basic_string_view &rhs) -> bool
+        {
+            if (lhs._sz != rhs._sz)
+            {
+                return false;
+            }
+
+            for (size_type i = 0u; i < lhs._sz; ++i)
+            {
+                if (lhs._p[i] != rhs._p[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
         private:
         pointer _p;
         size_type _sz;
@@ -11,7 +11,10 @@
 #ifndef MTL_TYPE_TRAITS_H
 #define MTL_TYPE_TRAITS_H
 
+#include <limits>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace mtl
 {
@@ -30,9 +33,19 @@ template <typename T> using has_const_iterator_v = typename has_const_iterator<T
 
 // *****************************************
 // alignment_of
-template <typename T> struct alignment_of : integral_constant<size_t, alignof(T)> {};
+template <typename T> struct alignment_of : std::integral_constant<size_t, alignof(T)> {};
 
 template <typename T> inline constexpr size_t alignment_of_v = alignment_of<T>::value;
+
+// *****************************************
+// least_index_t
+/// @brief Narrowest unsigned type holding [0, N], e.g. indices into N
+/// elements with N itself as the "null" index.
+template <size_t N>
+using least_index_t =
+    std::conditional_t<N < std::numeric_limits<uint8_t>::max(),  uint8_t,
+    std::conditional_t<N < std::numeric_limits<uint16_t>::max(), uint16_t,
+                                                                 uint32_t>>;
 }
 
 #endif
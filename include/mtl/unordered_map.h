@@ -0,0 +1,403 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file unordered_map.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Statically allocated open addressing hash map.
+///
+/// Keeps one control byte per slot (SwissTable layout): the low 7 bits of
+/// the key's hash when the slot is used, or an "empty"/"deleted" marker.
+/// Lookups probe groups of 16 control bytes at a time, comparing all of
+/// them against the hash in one go (SSE2 on x86, a plain loop otherwise),
+/// and only compare keys whose 7 bits matched.
+///
+/// The table has at least N / 0.875 slots, rounded up to a power of two,
+/// so probe sequences stay short even when the map holds N elements.
+/// Erased slots only become tombstones when their group is full, and once
+/// tombstones take 1/16 of the slots, the next insertion rehashes the table
+/// in place, so insert/erase churn does not turn every miss into a full
+/// table scan.
+///
+/// Everything is constexpr, so a table can be built at compile time:
+///
+/// @code
+/// constexpr mtl::static_unordered_map<mtl::string_view, uint8_t, 3> signals{
+///     {"rpm", 0u}, {"coolant_temp", 1u}, {"oil_pressure", 2u}};
+///
+/// static_assert(*signals.find("coolant_temp") == 1u);
+/// @endcode
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_UNORDERED_MAP_H
+#define MTL_UNORDERED_MAP_H
+
+#include <bit>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "hash.h"
+
+namespace mtl
+{
+namespace detail_unordered_map
+{
+    using ctrl_type = int8_t;
+
+    //! Control byte of a never used slot, stops lookups.
+    inline constexpr ctrl_type EMPTY = -128;
+    //! Control byte of an erased slot (tombstone), lookups go past it.
+    inline constexpr ctrl_type DELETED = -2;
+
+    inline constexpr size_t GROUP_SIZE = 16u;
+
+    /// @brief Bit i set for every control byte i of a group equal to `value`.
+    constexpr auto match(const ctrl_type *group, const ctrl_type value) -> uint32_t
+    {
+#if defined(__SSE2__)
+        if (!std::is_constant_evaluated())
+        {
+            const __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i *>(group));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+        }
+#endif
+        uint32_t mask = 0u;
+        for (size_t i = 0u; i < GROUP_SIZE; ++i)
+        {
+            mask |= static_cast<uint32_t>(group[i] == value) << i;
+        }
+
+        return mask;
+    }
+
+    /// @brief Bit i set for every empty or deleted control byte i of a group.
+    constexpr auto match_free(const ctrl_type *group) -> uint32_t
+    {
+#if defined(__SSE2__)
+        if (!std::is_constant_evaluated())
+        {
+            // Both markers are negative, used slots are not.
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(group))));
+        }
+#endif
+        uint32_t mask = 0u;
+        for (size_t i = 0u; i < GROUP_SIZE; ++i)
+        {
+            mask |= static_cast<uint32_t>(group[i] < 0) << i;
+        }
+
+        return mask;
+    }
+
+    /// @brief Amount of slots for N elements at a load factor <= 7/8.
+    constexpr auto slot_count(const size_t n) -> size_t
+    {
+        return std::max(GROUP_SIZE, std::bit_ceil(n + (n + 6u) / 7u));
+    }
+}
+
+// Statically allocated hash map.
+//
+// K and V must be default constructible, slots hold default values while
+// unused. `find()` returns nullptr for missing keys, insertions return false
+// when the map holds N elements already.
+template <typename K, typename V, size_t N, typename Hash = mtl::hash<K>>
+class static_unordered_map
+{
+    static_assert(N > 0u, "static_unordered_map<K, V, N>: N must be > 0");
+
+    using ctrl_type = detail_unordered_map::ctrl_type;
+
+    public:
+    using size_type   = size_t;
+    using key_type    = K;
+    using mapped_type = V;
+
+    constexpr static_unordered_map() { this->clear(); }
+
+    /// @brief Builds the map from key/value pairs, the first of duplicate
+    /// keys wins. Pairs past N are ignored.
+    constexpr static_unordered_map(const std::initializer_list<std::pair<K, V>> init)
+        : static_unordered_map()
+    {
+        for (const auto &[key, value] : init)
+        {
+            this->insert(key, value);
+        }
+    }
+
+    /// @brief Inserts `key` if it is not in the map yet.
+    /// @return false when the key was present or the map is full.
+    constexpr auto insert(const K &key, const V &value) -> bool
+    {
+        const size_t h = this->_hash(key);
+        if (this->find_slot(key, h) != NPOS || this->full())
+        {
+            return false;
+        }
+
+        this->place(h, key, value);
+        return true;
+    }
+
+    /// @brief Inserts `key`, or overwrites its value if it is present.
+    /// @return false when the map is full.
+    constexpr auto insert_or_assign(const K &key, const V &value) -> bool
+    {
+        const size_t h = this->_hash(key);
+        if (const size_type i = this->find_slot(key, h); i != NPOS)
+        {
+            this->_values[i] = value;
+            return true;
+        }
+
+        if (this->full())
+        {
+            return false;
+        }
+
+        this->place(h, key, value);
+        return true;
+    }
+
+    /// @return Value mapped to `key`, nullptr when missing.
+    constexpr auto find(const K &key) -> V *
+    {
+        const size_type i = this->find_slot(key, this->_hash(key));
+        return i != NPOS ? &this->_values[i] : nullptr;
+    }
+
+    constexpr auto find(const K &key) const -> const V *
+    {
+        const size_type i = this->find_slot(key, this->_hash(key));
+        return i != NPOS ? &this->_values[i] : nullptr;
+    }
+
+    constexpr auto contains(const K &key) const -> bool { return this->find_slot(key, this->_hash(key)) != NPOS; }
+
+    /// @return false when `key` was not in the map.
+    constexpr auto erase(const K &key) -> bool
+    {
+        const size_type i = this->find_slot(key, this->_hash(key));
+        if (i == NPOS)
+        {
+            return false;
+        }
+
+        // A lookup only stops at a group with an empty slot, so if this
+        // group has none, some probe sequence may run through it.
+        const ctrl_type *group = &this->_ctrl[i & ~(detail_unordered_map::GROUP_SIZE - 1u)];
+        if (detail_unordered_map::match(group, detail_unordered_map::EMPTY) != 0u)
+        {
+            this->_ctrl[i] = detail_unordered_map::EMPTY;
+        }
+        else
+        {
+            this->_ctrl[i] = detail_unordered_map::DELETED;
+            ++this->_deleted;
+        }
+
+        this->release(i);
+        --this->_size;
+        return true;
+    }
+
+    constexpr void clear()
+    {
+        for (size_type i = 0u; i < SLOTS; ++i)
+        {
+            this->release(i);
+            this->_ctrl[i] = detail_unordered_map::EMPTY;
+        }
+
+        this->_size    = 0u;
+        this->_deleted = 0u;
+    }
+
+    /// @brief Calls `fn(key, value)` for every element, in no particular order.
+    template <typename Fn>
+    constexpr void for_each(Fn &&fn)
+    {
+        for (size_type i = 0u; i < SLOTS; ++i)
+        {
+            if (this->_ctrl[i] >= 0) { fn(std::as_const(this->_keys[i]), this->_values[i]); }
+        }
+    }
+
+    template <typename Fn>
+    constexpr void for_each(Fn &&fn) const
+    {
+        for (size_type i = 0u; i < SLOTS; ++i)
+        {
+            if (this->_ctrl[i] >= 0) { fn(this->_keys[i], this->_values[i]); }
+        }
+    }
+
+    constexpr auto size() const -> size_type { return this->_size; }
+    constexpr auto empty() const -> bool { return this->_size == 0u; }
+    constexpr auto full() const -> bool { return this->_size == N; }
+    static constexpr auto capacity() -> size_type { return N; }
+
+    private:
+    static constexpr size_type SLOTS  = detail_unordered_map::slot_count(N);
+    static constexpr size_type GROUPS = SLOTS / detail_unordered_map::GROUP_SIZE;
+    static constexpr size_type NPOS   = SLOTS;
+    //! Tombstones from which insertions rehash first. Each rehash costs
+    //! O(SLOTS) and clears that many, so erase stays amortized O(1).
+    static constexpr size_type MAX_DELETED = SLOTS / 16u;
+
+    // The high bits select the first group, the low 7 bits go into the
+    // control byte, so the two stay independent.
+    static constexpr auto h1(const size_t h) -> size_type { return (h >> 7u) & (GROUPS - 1u); }
+    static constexpr auto h2(const size_t h) -> ctrl_type { return static_cast<ctrl_type>(h & 0x7fu); }
+
+    // Probing visits groups g, g+1, g+3, g+6... (triangular steps), which
+    // reaches every group once when their amount is a power of two.
+
+    constexpr auto find_slot(const K &key, const size_t h) const -> size_type
+    {
+        size_type g = h1(h);
+        for (size_type step = 1u; step <= GROUPS; ++step)
+        {
+            const ctrl_type *group = &this->_ctrl[g * detail_unordered_map::GROUP_SIZE];
+
+            for (uint32_t m = detail_unordered_map::match(group, h2(h)); m != 0u; m &= m - 1u)
+            {
+                const size_type i = g * detail_unordered_map::GROUP_SIZE + std::countr_zero(m);
+                if (this->_keys[i] == key)
+                {
+                    return i;
+                }
+            }
+
+            if (detail_unordered_map::match(group, detail_unordered_map::EMPTY) != 0u)
+            {
+                break;
+            }
+
+            g = (g + step) & (GROUPS - 1u);
+        }
+
+        return NPOS;
+    }
+
+    /// @brief First empty or deleted slot of the probe sequence of `h`.
+    /// The map must have one.
+    constexpr auto first_free(const size_t h) const -> size_type
+    {
+        size_type g = h1(h);
+        for (size_type step = 1u;; ++step)
+        {
+            const ctrl_type *group = &this->_ctrl[g * detail_unordered_map::GROUP_SIZE];
+
+            if (const uint32_t m = detail_unordered_map::match_free(group); m != 0u)
+            {
+                return g * detail_unordered_map::GROUP_SIZE + std::countr_zero(m);
+            }
+
+            g = (g + step) & (GROUPS - 1u);
+        }
+    }
+
+    /// @brief Stores a key known to be missing in the first free slot of its
+    /// probe sequence. The map must not be full.
+    constexpr void place(const size_t h, const K &key, const V &value)
+    {
+        if (this->_deleted >= MAX_DELETED)
+        {
+            this->rehash_in_place();
+        }
+
+        const size_type i = this->first_free(h);
+        if (this->_ctrl[i] == detail_unordered_map::DELETED)
+        {
+            --this->_deleted;
+        }
+
+        this->_ctrl[i]   = h2(h);
+        this->_keys[i]   = key;
+        this->_values[i] = value;
+
+        ++this->_size;
+    }
+
+    /// @brief Drops every tombstone, moving the elements to where they would
+    /// land in a fresh table, without extra storage (SwissTable's in place
+    /// rehash). Elements still to be placed are marked as deleted meanwhile.
+    constexpr void rehash_in_place()
+    {
+        for (size_type i = 0u; i < SLOTS; ++i)
+        {
+            this->_ctrl[i] = this->_ctrl[i] >= 0 ? detail_unordered_map::DELETED : detail_unordered_map::EMPTY;
+        }
+
+        for (size_type i = 0u; i < SLOTS; ++i)
+        {
+            if (this->_ctrl[i] != detail_unordered_map::DELETED)
+            {
+                continue;
+            }
+
+            const size_t    h      = this->_hash(this->_keys[i]);
+            const size_type target = this->first_free(h);
+
+            // Groups are probed whole, so staying in the group is as good.
+            if (target / detail_unordered_map::GROUP_SIZE == i / detail_unordered_map::GROUP_SIZE)
+            {
+                this->_ctrl[i] = h2(h);
+                continue;
+            }
+
+            if (this->_ctrl[target] == detail_unordered_map::EMPTY)
+            {
+                this->_keys[target]   = std::move(this->_keys[i]);
+                this->_values[target] = std::move(this->_values[i]);
+                this->_ctrl[target]   = h2(h);
+                this->_ctrl[i]        = detail_unordered_map::EMPTY;
+                this->release(i);
+            }
+            else
+            {
+                // Another element waits at `target`, swap and place it next.
+                std::swap(this->_keys[i], this->_keys[target]);
+                std::swap(this->_values[i], this->_values[target]);
+                this->_ctrl[target] = h2(h);
+                --i;
+            }
+        }
+
+        this->_deleted = 0u;
+    }
+
+    /// @brief Releases whatever slot `i` holds, it is not destroyed.
+    constexpr void release(const size_type i)
+    {
+        if constexpr (!std::is_trivially_destructible_v<K>) { this->_keys[i] = K{}; }
+        if constexpr (!std::is_trivially_destructible_v<V>) { this->_values[i] = V{}; }
+    }
+
+    alignas(detail_unordered_map::GROUP_SIZE) std::array<ctrl_type, SLOTS> _ctrl{};
+
+    std::array<K, SLOTS> _keys{};
+    std::array<V, SLOTS> _values{};
+
+    size_type _size    = 0u;
+    size_type _deleted = 0u;
+
+    [[no_unique_address]] Hash _hash{};
+};
+}
+
+#endif
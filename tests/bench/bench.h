@@ -0,0 +1,44 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file bench.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Timing helpers for the benchmark executables.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_TESTS_BENCH_H
+#define MTL_TESTS_BENCH_H
+
+#include <chrono>
+#include <cstdio>
+
+namespace mtl_bench
+{
+/// @brief Keeps the compiler from optimizing `value` away.
+template <typename T>
+inline void keep(T &&value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// @brief Runs `fn` once and returns the elapsed time in seconds.
+template <typename Fn>
+auto time(Fn &&fn) -> double
+{
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Prints `ops` operations done in `seconds` as ns/op and Mops/s.
+inline void report(const char *name, const double ops, const double seconds)
+{
+    std::printf("%-40s %10.2f ns/op %10.2f Mops/s\n", name, seconds * 1e9 / ops, ops / seconds / 1e6);
+}
+}
+
+#endif
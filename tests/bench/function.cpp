@@ -0,0 +1,55 @@
+// Call overhead and object size of mtl::function against std::function and a
+// raw function pointer, all calling the same small target. The callables are
+// reached through a volatile pointer so the calls cannot be inlined.
+
+#include <mtl/function.h>
+#include <mtl/function_ref.h>
+
+#include <cstdio>
+#include <cstdint>
+#include <functional>
+
+#include "bench.h"
+
+namespace
+{
+constexpr uint32_t CALLS = 200'000'000u;
+
+[[gnu::noinline]] auto add(const uint32_t x) -> uint32_t { return x + 3u; }
+
+template <typename F>
+void run(const char *name, F f)
+{
+    F *volatile fp = &f;
+
+    const double seconds = mtl_bench::time(
+        [&]
+        {
+            F       &fn  = *fp;
+            uint32_t acc = 0u;
+            for (uint32_t i = 0u; i < CALLS; ++i)
+            {
+                acc = fn(acc);
+            }
+            mtl_bench::keep(acc);
+        });
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s (%zu bytes)", name, sizeof(F));
+    mtl_bench::report(label, CALLS, seconds);
+}
+}
+
+int main()
+{
+    uint32_t step = 3u;
+
+    run<uint32_t (*)(uint32_t)>("raw function pointer", &add);
+    run<mtl::function<16, uint32_t(uint32_t)>>("mtl::function<16>, function", &add);
+    run<mtl::function<16, uint32_t(uint32_t)>>("mtl::function<16>, lambda", [&step](uint32_t x) { return x + step; });
+    run<std::function<uint32_t(uint32_t)>>("std::function, function", &add);
+    run<std::function<uint32_t(uint32_t)>>("std::function, lambda", [&step](uint32_t x) { return x + step; });
+
+    auto lambda = [&step](uint32_t x) { return x + step; };
+    run<mtl::function_ref<uint32_t(uint32_t)>>("mtl::function_ref, lambda", lambda);
+}
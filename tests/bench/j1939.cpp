@@ -0,0 +1,228 @@
+// Replays a candump log (`candump -l` format) through j1939::reassembler and
+// reports the cost per frame. A fully loaded 250 kbit/s J1939 bus carries
+// about 1900 extended frames per second, the budget left for everything else
+// is what this number is compared against.
+//
+//     bench_j1939 [capture.log]
+//
+// Without a capture a synthetic one is written first: 64 nodes sending single
+// frames, BAM and RTS/CTS transfers and fast packets, one after the other.
+
+#include <mtl/protocol/j1939.h>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+#include "bench.h"
+
+namespace can   = mtl::can;
+namespace j1939 = mtl::j1939;
+
+namespace
+{
+constexpr j1939::pgn_type FAST_PGN  = 0x1f805u;
+constexpr double          BUS_RATE  = 1900.0; // frames/s, 250 kbit/s at full load
+constexpr size_t          REPEAT    = 20u;
+constexpr uint32_t        SYNTHETIC = 200'000u;
+
+struct record
+{
+    std::chrono::milliseconds _time;
+    can::frame                _frame;
+};
+
+void put(std::FILE *f, const double t, const j1939::id_fields &id, const uint8_t *data, const size_t len)
+{
+    std::fprintf(f, "(%.6f) can0 %08X#", t, static_cast<unsigned>(j1939::make_id(id)));
+    for (size_t i = 0u; i < len; ++i)
+    {
+        std::fprintf(f, "%02X", data[i]);
+    }
+    std::fputc('\n', f);
+}
+
+/// @brief Writes a capture of about `frames` frames to `path`.
+auto synthesize(const char *path, const uint32_t frames) -> bool
+{
+    std::FILE *f = std::fopen(path, "w");
+    if (f == nullptr)
+    {
+        return false;
+    }
+
+    std::mt19937            rng{1939u};
+    std::array<uint8_t, 8>  d{};
+    std::array<uint8_t, 64> fp_sequence{};
+    double                  t    = 0.0;
+    uint32_t                n    = 0u;
+    const auto              tick = [&] {
+        t += 1.0 / BUS_RATE;
+        ++n;
+    };
+
+    while (n < frames)
+    {
+        const uint8_t  src  = static_cast<uint8_t>(rng() % 64u);
+        const uint32_t kind = rng() % 16u;
+
+        for (auto &b : d) { b = static_cast<uint8_t>(rng()); }
+
+        if (kind < 10u) // single frame broadcast
+        {
+            put(f, t, {3u, static_cast<j1939::pgn_type>(0xf000u + rng() % 0x100u), src, j1939::global_address}, d.data(), 8u);
+            tick();
+        }
+        else if (kind < 13u) // fast packet, 9..223 bytes
+        {
+            const uint8_t size     = static_cast<uint8_t>(9u + rng() % 215u);
+            const uint8_t sequence = fp_sequence[src]++ & 0x7u;
+            size_t        sent     = 6u;
+
+            d[0] = static_cast<uint8_t>(sequence << 5u);
+            d[1] = size;
+            put(f, t, {3u, FAST_PGN, src, j1939::global_address}, d.data(), 8u);
+            tick();
+
+            for (uint8_t frame = 1u; sent < size; ++frame, sent += 7u)
+            {
+                d[0] = static_cast<uint8_t>((sequence << 5u) | frame);
+                put(f, t, {3u, FAST_PGN, src, j1939::global_address}, d.data(), 8u);
+                tick();
+            }
+        }
+        else // BAM or RTS/CTS, 9..1785 bytes
+        {
+            const bool     bam     = kind < 15u;
+            const uint8_t  dst     = bam ? j1939::global_address : static_cast<uint8_t>(64u + src);
+            const uint16_t size    = static_cast<uint16_t>(9u + rng() % (j1939::max_tp_size - 8u));
+            const uint8_t  packets = static_cast<uint8_t>((size + 6u) / 7u);
+            const uint8_t  pgn[3]  = {0xcau, 0xfeu, 0x00u};
+
+            const std::array<uint8_t, 8> cm = {static_cast<uint8_t>(bam ? 32u : 16u), static_cast<uint8_t>(size),
+                                               static_cast<uint8_t>(size >> 8u), packets, 0xffu, pgn[0], pgn[1],
+                                               pgn[2]};
+            put(f, t, {7u, j1939::tp_cm_pgn, src, dst}, cm.data(), 8u);
+            tick();
+
+            for (unsigned seq = 1u; seq <= packets; ++seq)
+            {
+                if (!bam && seq % 16u == 1u) // CTS for the next 16 packets
+                {
+                    const std::array<uint8_t, 8> cts = {17u, 16u, static_cast<uint8_t>(seq), 0xffu, 0xffu,
+                                                        pgn[0],  pgn[1], pgn[2]};
+                    put(f, t, {7u, j1939::tp_cm_pgn, dst, src}, cts.data(), 8u);
+                    tick();
+                }
+
+                d[0] = static_cast<uint8_t>(seq);
+                put(f, t, {7u, j1939::tp_dt_pgn, src, dst}, d.data(), 8u);
+                tick();
+            }
+        }
+    }
+
+    return std::fclose(f) == 0;
+}
+
+/// @brief Reads `(seconds) iface ID#DATA` lines, other lines are skipped.
+auto load(const char *path) -> std::vector<record>
+{
+    std::vector<record> out;
+
+    std::FILE *f = std::fopen(path, "r");
+    if (f == nullptr)
+    {
+        return out;
+    }
+
+    char line[256];
+    while (std::fgets(line, sizeof(line), f) != nullptr)
+    {
+        double t = 0.0;
+        char   iface[32];
+        char   body[160];
+        if (std::sscanf(line, "(%lf) %31s %159s", &t, iface, body) != 3)
+        {
+            continue;
+        }
+
+        const std::string s{body};
+        const size_t      hash = s.find('#');
+        if (hash != 8u || s.find('#', hash + 1u) != std::string::npos)
+        {
+            continue; // standard frames, remote frames and CAN FD are not J1939
+        }
+        const auto id = static_cast<can::id_type>(std::strtoul(s.substr(0u, hash).c_str(), nullptr, 16));
+
+        std::array<uint8_t, 8> data{};
+        size_t                 len = 0u;
+        for (size_t i = hash + 1u; i + 1u < s.size() && len < data.size(); i += 2u)
+        {
+            data[len++] = static_cast<uint8_t>(std::strtoul(s.substr(i, 2u).c_str(), nullptr, 16));
+        }
+
+        out.push_back({std::chrono::milliseconds{static_cast<int64_t>(t * 1e3)},
+                       can::frame(id, true, {data.data(), len})});
+    }
+
+    std::fclose(f);
+    return out;
+}
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "j1939_synthetic.log";
+    if (argc <= 1 && !synthesize(path, SYNTHETIC))
+    {
+        std::fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+
+    const std::vector<record> frames = load(path);
+    if (frames.empty())
+    {
+        std::fprintf(stderr, "no extended frames in %s\n", path);
+        return 1;
+    }
+
+    size_t packets = 0u;
+    size_t bytes   = 0u;
+    size_t dropped = 0u;
+
+    const double seconds = mtl_bench::time([&] {
+        for (size_t r = 0u; r < REPEAT; ++r)
+        {
+            j1939::reassembler<64u> rx{[&](const j1939::packet &p) {
+                                           ++packets;
+                                           bytes += p._data.size();
+                                       },
+                                       [](const j1939::pgn_type pgn) { return pgn == FAST_PGN; }};
+
+            const std::chrono::milliseconds offset = frames.back()._time * static_cast<int64_t>(r + 1u);
+            for (const record &rec : frames)
+            {
+                rx.on_frame(rec._frame, offset + rec._time);
+                rx.poll(offset + rec._time);
+            }
+
+            dropped += rx.get_dropped();
+        }
+    });
+
+    const double ops = static_cast<double>(frames.size() * REPEAT);
+
+    std::printf("%s: %zu frames, %zu packets (%zu bytes), %zu dropped per replay\n", path, frames.size(),
+                packets / REPEAT, bytes / REPEAT, dropped / REPEAT);
+    mtl_bench::report("reassembler<64>::on_frame + poll", ops, seconds);
+    std::printf("%-40s %10.4f %% of one core\n", "250 kbit/s bus at full load", BUS_RATE * seconds / ops * 100.0);
+
+    mtl_bench::keep(packets);
+    return 0;
+}
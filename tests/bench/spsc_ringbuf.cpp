@@ -0,0 +1,80 @@
+// Two-thread throughput: spsc_ring_buffer against ring_buffer behind a mutex
+// (what the single-threaded class needs between an ISR/task pair), for single
+// element and burst transfers.
+
+#include <mtl/ringbuf.h>
+#include <mtl/spsc_ringbuf.h>
+
+#include <mutex>
+#include <thread>
+#include <cstdint>
+
+#include "bench.h"
+
+namespace
+{
+constexpr uint32_t COUNT = 10'000'000u;
+constexpr size_t   SIZE  = 1024u;
+
+struct locked_ring_buffer
+{
+    auto write(const uint32_t *data, const size_t n) -> size_t
+    {
+        std::lock_guard lock{this->_mutex};
+        return this->_rb.write(data, n);
+    }
+
+    auto read(uint32_t *dest, const size_t n) -> size_t
+    {
+        std::lock_guard lock{this->_mutex};
+        return this->_rb.read(dest, n);
+    }
+
+    std::mutex                       _mutex;
+    mtl::ring_buffer<uint32_t, SIZE> _rb;
+};
+
+template <typename Buffer>
+void run(const char *name, const size_t burst)
+{
+    static Buffer rb;
+
+    const double seconds = mtl_bench::time(
+        [&]
+        {
+            std::thread producer(
+                [&]
+                {
+                    uint32_t buf[64]{};
+                    for (uint32_t sent = 0u; sent < COUNT;)
+                    {
+                        buf[0] = sent;
+                        const size_t n = rb.write(buf, std::min<size_t>(burst, COUNT - sent));
+                        if (n == 0u) { std::this_thread::yield(); }
+                        sent += static_cast<uint32_t>(n);
+                    }
+                });
+
+            uint32_t buf[64];
+            for (uint32_t got = 0u; got < COUNT;)
+            {
+                const size_t n = rb.read(buf, burst);
+                if (n == 0u) { std::this_thread::yield(); }
+                got += static_cast<uint32_t>(n);
+            }
+            mtl_bench::keep(buf[0]);
+
+            producer.join();
+        });
+
+    mtl_bench::report(name, COUNT, seconds);
+}
+}
+
+int main()
+{
+    run<mtl::spsc_ring_buffer<uint32_t, SIZE>>("spsc_ring_buffer, 1 element", 1u);
+    run<locked_ring_buffer>("mutex + ring_buffer, 1 element", 1u);
+    run<mtl::spsc_ring_buffer<uint32_t, SIZE>>("spsc_ring_buffer, 64 element bursts", 64u);
+    run<locked_ring_buffer>("mutex + ring_buffer, 64 element bursts", 64u);
+}
@@ -0,0 +1,190 @@
+// can_acceptance: fixed cases, and a randomized differential test of
+// `matches()` against a model of the Linux kernel's CAN_RAW filtering
+// (net/can/af_can.c), fed with the filters `to_kernel()` produces, over
+// random rules (stray upper bits included) and frames.
+
+#include <mtl/filter/can_acceptance.h>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test.h"
+
+namespace can = mtl::can;
+
+// can_rx_register() -> can_rcv_list_find() then can_rcv_filter(), with every
+// receive list flattened into one.
+struct kernel_model
+{
+    enum class list { all, fil, inv, err };
+
+    struct entry
+    {
+        can::id_type _id;
+        can::id_type _mask;
+        list         _list;
+    };
+
+    std::vector<entry> _entries;
+
+    void add(can::id_type id, can::id_type mask)
+    {
+        const can::id_type inv = id & can::inv_filter;
+
+        if ((mask & can::err_flag) != 0u)
+        {
+            _entries.push_back({id, mask & can::err_mask, list::err});
+            return;
+        }
+
+        if ((mask & can::eff_flag) != 0u && (id & can::eff_flag) == 0u)
+        {
+            mask &= can::sff_mask | can::eff_flag | can::rtr_flag;
+        }
+
+        id &= mask;
+
+        // The sff/eff exact match lists are plain (id, mask) checks too.
+        _entries.push_back({id, mask, inv != 0u ? list::inv : mask == 0u ? list::all : list::fil});
+    }
+
+    auto matches(const can::id_type id) const -> bool
+    {
+        for (const entry &e : _entries)
+        {
+            if ((id & can::err_flag) != 0u)
+            {
+                if (e._list == list::err && (id & e._mask) != 0u) { return true; }
+                continue;
+            }
+
+            switch (e._list)
+            {
+                case list::all: return true;
+                case list::fil: if ((id & e._mask) == e._id) { return true; } break;
+                case list::inv: if ((id & e._mask) != e._id) { return true; } break;
+                case list::err: break;
+            }
+        }
+
+        return false;
+    }
+};
+
+namespace
+{
+void test_fixed_cases()
+{
+    mtl::filter::can_acceptance<8> rx;
+    rx.add(can::filter{0x100u, 0x700u});
+    rx.add({0x18fef100u, 0x18fef1ffu, true});
+    // SFF filter (no eff flag in the id) with eff bits in its mask: the
+    // kernel only looks at the 11-bit id.
+    rx.add(can::filter{0x18fef300u, can::eff_flag | can::eff_mask});
+    // Error frame filter, bus-off class.
+    rx.add(can::filter{0u, can::err_flag | 0x40u});
+    rx.compile();
+
+    MTL_CHECK(rx.matches(0x1abu));
+    MTL_CHECK(rx.matches(0x1abu | can::rtr_flag));
+    MTL_CHECK(rx.matches(can::eff_flag | 0x1abu));
+    MTL_CHECK(!rx.matches(0x2abu));
+    MTL_CHECK(rx.matches(can::eff_flag | 0x18fef17fu));
+    MTL_CHECK(!rx.matches(can::eff_flag | 0x18fef200u));
+    MTL_CHECK(rx.matches(0x300u));
+    MTL_CHECK(!rx.matches(can::eff_flag | 0x18fef300u));
+    MTL_CHECK(rx.matches(can::err_flag | 0x40u));
+    MTL_CHECK(!rx.matches(can::err_flag | 0x04u));
+
+    const can::frame f{0x1ffu, false, {}};
+    MTL_CHECK(rx.matches(f));
+
+    std::array<can::filter, 64> out{};
+    MTL_CHECK(rx.to_kernel(out) >= 4u);
+}
+
+// N > 16 and N <= 16 sort the rules differently.
+template <size_t N>
+void test_against_kernel()
+{
+    std::mt19937 rng{1u};
+    auto         bits = [&](const can::id_type mask) { return static_cast<can::id_type>(rng()) & mask; };
+
+    // Frames as a CAN_RAW socket sees them.
+    auto random_frame = [&]() -> can::id_type
+    {
+        switch (rng() % 4u)
+        {
+            case 0u: return bits(can::sff_mask) | bits(can::rtr_flag);
+            case 1u: return can::eff_flag | bits(can::eff_mask) | bits(can::rtr_flag);
+            case 2u: return can::err_flag | bits(0x1ffu);
+            default: return rng() % 2u ? 0x100u : can::eff_flag | 0x18fef100u;
+        }
+    };
+
+    // Mostly near-sensible values, with random flags and upper bits.
+    auto random_word = [&]() -> can::id_type
+    {
+        const can::id_type flags = bits(can::eff_flag | can::rtr_flag | can::err_flag);
+        switch (rng() % 3u)
+        {
+            case 0u: return flags | bits(can::sff_mask);
+            case 1u: return flags | bits(can::eff_mask);
+            default: return flags | (rng() % 2u ? 0x18fef1ffu : 0x7ffu);
+        }
+    };
+
+    size_t mismatches = 0u;
+
+    for (int round = 0; round < 2000; ++round)
+    {
+        mtl::filter::can_acceptance<N> rx;
+
+        for (size_t n = rng() % (N + 1u); n-- > 0u;)
+        {
+            if (rng() % 4u == 0u)
+            {
+                const bool         ext  = rng() % 2u;
+                const can::id_type all  = ext ? can::eff_mask : can::sff_mask;
+                can::id_type       a    = bits(all);
+                can::id_type       b    = rng() % 2u ? a + bits(0xffu) : bits(all);
+                if (a > b) { std::swap(a, b); }
+                rx.add({a, std::min(b, all), ext});
+            }
+            else
+            {
+                rx.add(can::filter{random_word(), random_word()});
+            }
+        }
+        rx.compile();
+
+        std::array<can::filter, 512> out{};
+        const size_t                 count = rx.to_kernel(out);
+        if (count > out.size()) { continue; }
+
+        kernel_model kernel;
+        for (size_t i = 0u; i < count; ++i) { kernel.add(out[i]._id, out[i]._mask); }
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            const can::id_type id = random_frame();
+            if (rx.matches(id) != kernel.matches(id))
+            {
+                if (mismatches++ < 10u) { std::printf("mismatch: round %d, id %08x\n", round, id); }
+            }
+        }
+    }
+
+    MTL_CHECK(mismatches == 0u);
+}
+}
+
+int main()
+{
+    test_fixed_cases();
+    test_against_kernel<8>();
+    test_against_kernel<32>();
+
+    return mtl_test::result();
+}
@@ -0,0 +1,106 @@
+// CAN FD support in mtl::can: DLC <-> length tables, padding, and fd_frame
+// construction, clamping, flags and conversions.
+
+#include <mtl/interface/can.h>
+
+#include <array>
+#include <cstdint>
+#include <algorithm>
+
+#include "test.h"
+
+namespace can = mtl::can;
+
+namespace
+{
+void test_dlc_round_trip()
+{
+    for (uint8_t dlc = 0u; dlc < 16u; ++dlc)
+    {
+        MTL_CHECK(can::len_to_dlc(can::dlc_to_len(dlc)) == dlc);
+    }
+
+    // Only the low nibble is a DLC code.
+    MTL_CHECK(can::dlc_to_len(0x1fu) == 64u);
+}
+
+void test_len_to_dlc()
+{
+    for (size_t len = 0u; len <= can::max_fd_len; ++len)
+    {
+        const uint8_t dlc = can::len_to_dlc(len);
+
+        // Smallest code holding `len` bytes.
+        MTL_CHECK(can::dlc_to_len(dlc) >= len);
+        MTL_CHECK(dlc == 0u || can::dlc_to_len(static_cast<uint8_t>(dlc - 1u)) < len);
+        MTL_CHECK(can::fd_padded_len(len) == can::dlc_to_len(dlc));
+    }
+
+    MTL_CHECK(can::len_to_dlc(8u) == 8u);
+    MTL_CHECK(can::len_to_dlc(9u) == 9u);
+    MTL_CHECK(can::fd_padded_len(9u) == 12u);
+    MTL_CHECK(can::fd_padded_len(33u) == 48u);
+    MTL_CHECK(can::len_to_dlc(can::max_fd_len + 1u) == 15u);
+}
+
+void test_fd_frame()
+{
+    std::array<uint8_t, 64> payload{};
+    for (size_t i = 0u; i < payload.size(); ++i) { payload[i] = static_cast<uint8_t>(i + 1u); }
+
+    // Padded to the next valid length with zeros.
+    const can::fd_frame<> f{0x18fef100u, true, {payload.data(), 13u}, can::fd_brs};
+    MTL_CHECK(f._len == 16u);
+    MTL_CHECK(f.get_dlc() == 10u);
+    MTL_CHECK(f.get_id() == 0x18fef100u);
+    MTL_CHECK(f.is_extended());
+    MTL_CHECK(f.is_fd());
+    MTL_CHECK(f.is_brs());
+    MTL_CHECK(!f.is_esi());
+    MTL_CHECK(std::equal(f._data.begin(), f._data.begin() + 13, payload.begin()));
+    MTL_CHECK(f._data[13] == 0u && f._data[15] == 0u);
+
+    const can::fd_frame<> sff{0x7ffu | 0x800u, false, {payload.data(), 3u}};
+    MTL_CHECK(sff.get_id() == 0x7ffu);
+    MTL_CHECK(!sff.is_extended());
+    MTL_CHECK(sff.is_fd());
+    MTL_CHECK(!sff.is_brs());
+
+    // Clamped at Capacity.
+    const can::fd_frame<16> small{0x100u, false, payload};
+    MTL_CHECK(small._len == 16u);
+    MTL_CHECK(small._data[15] == 16u);
+
+    // Between capacities: flags kept, payload truncated.
+    const can::fd_frame<8> narrowed{f};
+    MTL_CHECK(narrowed._len == 8u);
+    MTL_CHECK(narrowed.is_fd() && narrowed.is_brs());
+    MTL_CHECK(narrowed._id == f._id);
+
+    const can::fd_frame<> widened{small};
+    MTL_CHECK(widened._len == 16u);
+    MTL_CHECK(widened.is_fd());
+}
+
+void test_from_classic_frame()
+{
+    const std::array<uint8_t, 5> payload{1u, 2u, 3u, 4u, 5u};
+    const can::frame             classic{0x123u, false, payload};
+    const can::fd_frame<>        f{classic};
+
+    MTL_CHECK(!f.is_fd());
+    MTL_CHECK(f._id == classic._id);
+    MTL_CHECK(f._len == 5u);
+    MTL_CHECK(std::equal(payload.begin(), payload.end(), f._data.begin()));
+}
+}
+
+int main()
+{
+    test_dlc_round_trip();
+    test_len_to_dlc();
+    test_fd_frame();
+    test_from_classic_frame();
+
+    return mtl_test::result();
+}
@@ -0,0 +1,128 @@
+// mtl::j1939::reassembler: BAM, RTS/CTS and fast packet reassembly, and
+// short frames that would otherwise leave a hole in the delivered payload.
+
+#include <mtl/protocol/j1939.h>
+
+#include <array>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <initializer_list>
+
+#include "test.h"
+
+namespace can   = mtl::can;
+namespace j1939 = mtl::j1939;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr j1939::pgn_type FAST_PGN = 0x1f805u;
+constexpr j1939::pgn_type TP_PGN   = 0xfecau;
+
+struct sink
+{
+    std::vector<std::vector<uint8_t>> _packets;
+};
+
+auto frame(const j1939::pgn_type pgn, const j1939::address_type src, const j1939::address_type dst,
+           const std::initializer_list<uint8_t> data) -> can::frame
+{
+    return can::frame(j1939::make_id({6u, pgn, src, dst}), true, {data.begin(), data.size()});
+}
+
+auto bam(const uint16_t size, const uint8_t packets) -> can::frame
+{
+    return frame(j1939::tp_cm_pgn, 0x10u, j1939::global_address,
+                 {32u, static_cast<uint8_t>(size), static_cast<uint8_t>(size >> 8u), packets, 0xffu,
+                  static_cast<uint8_t>(TP_PGN), static_cast<uint8_t>(TP_PGN >> 8u), 0u});
+}
+
+template <size_t Sessions>
+auto make(sink &out)
+{
+    // Temporaries on purpose: the reassembler keeps its own copies.
+    return j1939::reassembler<Sessions>{[&out](const j1939::packet &p) {
+                                            out._packets.emplace_back(p._data.begin(), p._data.end());
+                                        },
+                                        [](const j1939::pgn_type pgn) { return pgn == FAST_PGN; }};
+}
+
+void test_bam()
+{
+    sink out;
+    auto rx = make<4u>(out);
+
+    rx.on_frame(bam(10u, 2u), 0ms);
+    rx.on_frame(frame(j1939::tp_dt_pgn, 0x10u, j1939::global_address, {1u, 0u, 1u, 2u, 3u, 4u, 5u, 6u}), 10ms);
+    rx.on_frame(frame(j1939::tp_dt_pgn, 0x10u, j1939::global_address, {2u, 7u, 8u, 9u, 0xffu, 0xffu, 0xffu, 0xffu}),
+                20ms);
+
+    MTL_CHECK(out._packets.size() == 1u);
+    MTL_CHECK(out._packets.size() == 1u &&
+              out._packets[0] == (std::vector<uint8_t>{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u}));
+    MTL_CHECK(rx.get_active() == 0u);
+    MTL_CHECK(rx.get_dropped() == 0u);
+}
+
+void test_bam_short_packet()
+{
+    sink out;
+    auto rx = make<4u>(out);
+
+    // Packet 1 carries 3 bytes instead of 7, packet 2 would complete the size.
+    rx.on_frame(bam(10u, 2u), 0ms);
+    rx.on_frame(frame(j1939::tp_dt_pgn, 0x10u, j1939::global_address, {1u, 0u, 1u, 2u}), 10ms);
+    rx.on_frame(frame(j1939::tp_dt_pgn, 0x10u, j1939::global_address, {2u, 7u, 8u, 9u, 0xffu, 0xffu, 0xffu, 0xffu}),
+                20ms);
+
+    MTL_CHECK(out._packets.empty());
+    MTL_CHECK(rx.get_active() == 0u);
+    MTL_CHECK(rx.get_dropped() == 1u);
+}
+
+void test_fast_packet()
+{
+    sink out;
+    auto rx = make<4u>(out);
+
+    rx.on_frame(frame(FAST_PGN, 0x20u, j1939::global_address, {0x40u, 9u, 0u, 1u, 2u, 3u, 4u, 5u}), 0ms);
+    rx.on_frame(frame(FAST_PGN, 0x20u, j1939::global_address, {0x41u, 6u, 7u, 8u, 0xffu, 0xffu, 0xffu, 0xffu}), 1ms);
+
+    MTL_CHECK(out._packets.size() == 1u);
+    MTL_CHECK(out._packets.size() == 1u &&
+              out._packets[0] == (std::vector<uint8_t>{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u}));
+    MTL_CHECK(rx.get_dropped() == 0u);
+}
+
+void test_fast_packet_short_frame()
+{
+    sink out;
+    auto rx = make<4u>(out);
+
+    // Frame 0 with DLC 5: 3 of its 6 payload bytes are missing.
+    rx.on_frame(frame(FAST_PGN, 0x20u, j1939::global_address, {0x40u, 9u, 0u, 1u, 2u}), 0ms);
+    rx.on_frame(frame(FAST_PGN, 0x20u, j1939::global_address, {0x41u, 6u, 7u, 8u, 0xffu, 0xffu, 0xffu, 0xffu}), 1ms);
+
+    MTL_CHECK(out._packets.empty());
+    MTL_CHECK(rx.get_active() == 0u);
+    MTL_CHECK(rx.get_dropped() == 1u);
+
+    // Single frame fast packet announcing more bytes than it carries.
+    rx.on_frame(frame(FAST_PGN, 0x20u, j1939::global_address, {0x60u, 5u, 0u, 1u}), 2ms);
+
+    MTL_CHECK(out._packets.empty());
+    MTL_CHECK(rx.get_dropped() == 2u);
+}
+}
+
+int main()
+{
+    test_bam();
+    test_bam_short_packet();
+    test_fast_packet();
+    test_fast_packet_short_frame();
+
+    return mtl_test::result();
+}
@@ -0,0 +1,85 @@
+// spsc_ring_buffer: single context behaviour, and a producer/consumer stress
+// test checking every value arrives once and in order across threads.
+
+#include <mtl/spsc_ringbuf.h>
+
+#include <thread>
+#include <cstdint>
+
+#include "test.h"
+
+namespace
+{
+void test_single_context()
+{
+    mtl::spsc_ring_buffer<int, 8> rb;
+    int                           in[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    int                           out[12]{};
+
+    MTL_CHECK(rb.write(in, 12) == 8u);
+    MTL_CHECK(rb.get_occupied() == 8u);
+    MTL_CHECK(rb.get_free() == 0u);
+    MTL_CHECK(rb.write(in, 1) == 0u);
+
+    MTL_CHECK(rb.read(out, 5) == 5u);
+    MTL_CHECK(out[0] == 0 && out[4] == 4);
+
+    // Wraps around the end of the arena.
+    MTL_CHECK(rb.write(in + 8, 4) == 4u);
+    MTL_CHECK(rb.read(out, 12) == 7u);
+    MTL_CHECK(out[0] == 5 && out[2] == 7 && out[3] == 8 && out[6] == 11);
+    MTL_CHECK(rb.read(out, 1) == 0u);
+}
+
+void test_two_threads()
+{
+    constexpr uint32_t COUNT = 1'000'000u;
+
+    static mtl::spsc_ring_buffer<uint32_t, 256> rb;
+
+    std::thread producer(
+        [&]
+        {
+            uint32_t buf[64];
+            for (uint32_t next = 0u; next < COUNT;)
+            {
+                // Varying burst sizes, so writes end anywhere in the arena.
+                const uint32_t burst = std::min<uint32_t>(1u + next % 61u, COUNT - next);
+                for (uint32_t i = 0u; i < burst; ++i) { buf[i] = next + i; }
+
+                const size_t n = rb.write(buf, burst);
+                if (n == 0u) { std::this_thread::yield(); }
+                next += static_cast<uint32_t>(n);
+            }
+        });
+
+    uint32_t expected = 0u;
+    bool     ordered  = true;
+    uint32_t buf[64];
+
+    while (expected < COUNT)
+    {
+        const size_t n = rb.read(buf, 1u + expected % 64u);
+        if (n == 0u) { std::this_thread::yield(); }
+        for (size_t i = 0u; i < n; ++i)
+        {
+            ordered = ordered && buf[i] == expected;
+            ++expected;
+        }
+    }
+
+    producer.join();
+
+    MTL_CHECK(ordered);
+    MTL_CHECK(expected == COUNT);
+    MTL_CHECK(rb.get_occupied() == 0u);
+}
+}
+
+int main()
+{
+    test_single_context();
+    test_two_threads();
+
+    return mtl_test::result();
+}
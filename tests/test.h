@@ -0,0 +1,48 @@
+///-----------------------------------------------------------------------------
+/// MarineTelematics Template Library - (c) 2026 Marine Telematics
+///-----------------------------------------------------------------------------
+///
+/// @file test.h
+/// @author Gabriel Novalski (gabriel@marinetelematics.com.br)
+/// @date 18-10-2026
+///
+/// @brief Minimal checks for the test executables: `MTL_CHECK(cond)`
+/// reports the failed condition and keeps going, `main()` returns
+/// `mtl_test::result()`.
+///
+///-----------------------------------------------------------------------------
+
+#ifndef MTL_TESTS_TEST_H
+#define MTL_TESTS_TEST_H
+
+#include <cstdio>
+
+namespace mtl_test
+{
+inline int failures = 0;
+
+inline auto check(const bool ok, const char *expr, const char *file, const int line) -> bool
+{
+    if (!ok)
+    {
+        ++failures;
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+    }
+
+    return ok;
+}
+
+inline auto result() -> int
+{
+    if (failures != 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+    }
+
+    return failures == 0 ? 0 : 1;
+}
+}
+
+#define MTL_CHECK(cond) ::mtl_test::check(static_cast<bool>(cond), #cond, __FILE__, __LINE__)
+
+#endif